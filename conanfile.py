@@ -48,7 +48,8 @@ class UnitsConan(ConanFile):
     requires = (
         "range-v3/0.9.1@ericniebler/stable",
         "Catch2/2.10.0@catchorg/stable",
-        "fmt/6.0.0"
+        "fmt/6.0.0",
+        "benchmark/1.5.0"
     )
     generators = "cmake"
 
@@ -0,0 +1,214 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/bits/quantity_range.h>
+#include <units/quantity.h>
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <ranges>
+#include <type_traits>
+
+// Parallel algorithms over contiguous ranges of quantities
+//
+// The algorithms take a standard execution policy. Parallel policies run on the backend chosen at
+// build time with the `UNITS_PARALLEL_BACKEND` CMake option:
+// - `TBB` - the standard library parallel algorithms (libstdc++ implements them on top of TBB)
+// - `OPENMP` - OpenMP `parallel for simd` loops (`UNITS_PARALLEL_BACKEND_OPENMP` is defined)
+// - `NONE` - the standard library algorithms with their serial backend
+//
+// Result units are computed at compile time with the quantity operators. The loops themselves work on
+// raw representation values so they vectorize the same way as hand-written ones.
+
+namespace units {
+
+  namespace detail {
+
+    template<typename P>
+    concept ExecutionPolicy = std::is_execution_policy_v<std::remove_cvref_t<P>>;
+
+    template<typename P>
+    inline constexpr bool is_parallel_policy =
+        !std::is_same_v<std::remove_cvref_t<P>, std::execution::sequenced_policy> &&
+        !std::is_same_v<std::remove_cvref_t<P>, std::execution::unsequenced_policy>;
+
+    template<typename R, typename T>
+    concept OutputRange = std::ranges::contiguous_range<R> && std::ranges::sized_range<R> &&
+                          std::is_assignable_v<std::ranges::range_reference_t<R>, T>;
+
+    template<typename P>
+    inline constexpr bool use_openmp =
+#ifdef UNITS_PARALLEL_BACKEND_OPENMP
+        is_parallel_policy<P>;
+#else
+        false;
+#endif
+
+    template<ExecutionPolicy P, typename It, typename T, typename Proj>
+    T raw_sum(P&& policy, It first, std::ptrdiff_t n, T init, Proj proj)
+    {
+      if constexpr(use_openmp<P> && std::is_arithmetic_v<T>) {  // OpenMP reductions need built-in types
+        T sum = init;
+#ifdef UNITS_PARALLEL_BACKEND_OPENMP
+#pragma omp parallel for simd reduction(+ : sum)
+#endif
+        for(std::ptrdiff_t i = 0; i < n; ++i) sum += proj(first[i]);
+        return sum;
+      }
+      else {
+        return std::transform_reduce(std::forward<P>(policy), first, first + n, init, std::plus<>(), proj);
+      }
+    }
+
+    template<ExecutionPolicy P, typename It1, typename It2, typename T, typename Proj>
+    T raw_sum(P&& policy, It1 first1, It2 first2, std::ptrdiff_t n, T init, Proj proj)
+    {
+      if constexpr(use_openmp<P> && std::is_arithmetic_v<T>) {  // OpenMP reductions need built-in types
+        T sum = init;
+#ifdef UNITS_PARALLEL_BACKEND_OPENMP
+#pragma omp parallel for simd reduction(+ : sum)
+#endif
+        for(std::ptrdiff_t i = 0; i < n; ++i) sum += proj(first1[i], first2[i]);
+        return sum;
+      }
+      else {
+        return std::transform_reduce(std::forward<P>(policy), first1, first1 + n, first2, init, std::plus<>(), proj);
+      }
+    }
+
+    template<typename T>
+    struct raw_value {
+      using rep = T;
+      static constexpr rep count(const T& v) { return v; }
+      static constexpr T make(const rep& r) { return r; }
+    };
+
+    template<Quantity Q>
+    struct raw_value<Q> {
+      using rep = Q::rep;
+      static constexpr rep count(const Q& q) { return q.count(); }
+      static constexpr Q make(const rep& r) { return Q(r); }
+    };
+
+  }  // namespace detail
+
+  // transform
+
+  template<detail::ExecutionPolicy P, detail::QuantityRange In, typename Out, typename F>
+      requires std::invocable<F&, std::ranges::range_reference_t<const In>> &&
+               detail::OutputRange<Out, std::invoke_result_t<F&, std::ranges::range_reference_t<const In>>>
+  void transform(P&& policy, const In& in, Out&& out, F f)
+  {
+    const auto n = static_cast<std::ptrdiff_t>(std::ranges::size(in));
+    Expects(std::ranges::ssize(out) >= n);
+    const auto src = std::ranges::data(in);
+    const auto dst = std::ranges::data(out);
+    if constexpr(detail::use_openmp<P>) {
+#ifdef UNITS_PARALLEL_BACKEND_OPENMP
+#pragma omp parallel for simd
+#endif
+      for(std::ptrdiff_t i = 0; i < n; ++i) dst[i] = f(src[i]);
+    }
+    else {
+      std::transform(std::forward<P>(policy), src, src + n, dst, f);
+    }
+  }
+
+  template<detail::ExecutionPolicy P, detail::QuantityRange In1, detail::QuantityRange In2, typename Out, typename F>
+      requires std::invocable<F&, std::ranges::range_reference_t<const In1>, std::ranges::range_reference_t<const In2>> &&
+               detail::OutputRange<Out, std::invoke_result_t<F&, std::ranges::range_reference_t<const In1>,
+                                                             std::ranges::range_reference_t<const In2>>>
+  void transform(P&& policy, const In1& in1, const In2& in2, Out&& out, F f)
+  {
+    const auto n = static_cast<std::ptrdiff_t>(std::ranges::size(in1));
+    Expects(std::ranges::ssize(in2) >= n && std::ranges::ssize(out) >= n);
+    const auto src1 = std::ranges::data(in1);
+    const auto src2 = std::ranges::data(in2);
+    const auto dst = std::ranges::data(out);
+    if constexpr(detail::use_openmp<P>) {
+#ifdef UNITS_PARALLEL_BACKEND_OPENMP
+#pragma omp parallel for simd
+#endif
+      for(std::ptrdiff_t i = 0; i < n; ++i) dst[i] = f(src1[i], src2[i]);
+    }
+    else {
+      std::transform(std::forward<P>(policy), src1, src1 + n, src2, dst, f);
+    }
+  }
+
+  // reduce
+
+  // Sum of the quantities in their own unit
+  template<detail::ExecutionPolicy P, detail::QuantityRange R>
+  [[nodiscard]] std::ranges::range_value_t<R> reduce(P&& policy, const R& xs)
+  {
+    using Q = std::ranges::range_value_t<R>;
+    using rep = Q::rep;
+    const auto n = static_cast<std::ptrdiff_t>(std::ranges::size(xs));
+    return Q(detail::raw_sum(std::forward<P>(policy), std::ranges::data(xs), n, rep(0),
+                             [](const Q& q) { return q.count(); }));
+  }
+
+  // transform_reduce
+
+  // Sum of `f(x)`. The result type is the one returned by `f`, i.e. `quantity<square_metre>` for
+  // `[](auto x) { return x * x; }` over lengths.
+  template<detail::ExecutionPolicy P, detail::QuantityRange R, typename F,
+           typename T = std::invoke_result_t<F&, std::ranges::range_reference_t<const R>>>
+  [[nodiscard]] T transform_reduce(P&& policy, const R& xs, F f)
+      requires Quantity<T> || Scalar<T>
+  {
+    using raw = detail::raw_value<T>;
+    const auto n = static_cast<std::ptrdiff_t>(std::ranges::size(xs));
+    return raw::make(detail::raw_sum(std::forward<P>(policy), std::ranges::data(xs), n, typename raw::rep(0),
+                                     [&f](const auto& x) { return raw::count(f(x)); }));
+  }
+
+  // Sum of element-wise products, i.e. lengths and forces give an energy through `dimension_multiply`
+  template<detail::ExecutionPolicy P, detail::QuantityRange R1, detail::QuantityRange R2>
+  [[nodiscard]] auto transform_reduce(P&& policy, const R1& xs, const R2& ys)
+  {
+    using Q1 = std::ranges::range_value_t<R1>;
+    using Q2 = std::ranges::range_value_t<R2>;
+    const auto n = static_cast<std::ptrdiff_t>(std::ranges::size(xs));
+    Expects(std::ranges::ssize(ys) >= n);
+    using rep = decltype(std::declval<typename Q1::rep>() * std::declval<typename Q2::rep>());
+    const rep sum = detail::raw_sum(std::forward<P>(policy), std::ranges::data(xs), std::ranges::data(ys), n, rep(0),
+                                    [](const Q1& x, const Q2& y) { return x.count() * y.count(); });
+    if constexpr(same_dim<typename Q1::dimension, dim_invert<typename Q2::dimension>>) {
+      // dimensionless result scaled as in `quantity` multiplication, after the sum so that a fractional
+      // ratio does not truncate to 0 for integral representations
+      using ratio = ratio_multiply<typename Q1::unit::ratio, typename Q2::unit::ratio>;
+      return sum * rep(ratio::num) / rep(ratio::den);
+    }
+    else {
+      // the product of unit quantities carries the unit of the result
+      return quantity<typename Q1::unit, rep>(1) * quantity<typename Q2::unit, rep>(1) * sum;
+    }
+  }
+
+}  // namespace units
@@ -0,0 +1,137 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/dimension_code.h>
+#include <units/quantity.h>
+#include <cstdint>
+#include <type_traits>
+#include <typeinfo>
+
+namespace units {
+
+  // bad_any_quantity_cast
+
+  class bad_any_quantity_cast : public std::bad_cast {
+  public:
+    const char* what() const noexcept override { return "bad any_quantity_cast"; }
+  };
+
+  // any_quantity
+
+  // Type-erased quantity that can be passed through non-template interfaces. The value is stored in the
+  // coherent unit of its dimension so that casting to any unit of the same dimension is a single multiply.
+  // The scale of the original unit is kept to be able to retrieve the value in that unit.
+  // Please note that integral representations wider than 53 bits may lose precision.
+  //
+  // `any_quantity_cast` to an integral representation rounds to the nearest integer, so that a value
+  // survives the round trip through the stored `double` (i.e. 4007 mm is 4.007 m, which is not exact).
+  class any_quantity {
+    double value_ = 0;
+    dimension_code dimension_;
+    double scale_ = 1;
+
+    template<Ratio R>
+    static constexpr double ratio_value = static_cast<double>(R::num) / static_cast<double>(R::den);
+
+  public:
+    any_quantity() = default;
+
+    constexpr any_quantity(double value, dimension_code d, double scale = 1) noexcept:
+        value_(value * scale), dimension_(d), scale_(scale)
+    {
+    }
+
+    template<typename U, typename Rep>
+        requires EncodableDimension<typename U::dimension>
+    constexpr any_quantity(const quantity<U, Rep>& q) noexcept:
+        value_(static_cast<double>(q.count()) * ratio_value<typename U::ratio>),
+        dimension_(dimension_code_of<typename U::dimension>),
+        scale_(ratio_value<typename U::ratio>)
+    {
+    }
+
+    [[nodiscard]] constexpr double count() const noexcept { return value_ / scale_; }
+    [[nodiscard]] constexpr double coherent_count() const noexcept { return value_; }
+    [[nodiscard]] constexpr double scale() const noexcept { return scale_; }
+    [[nodiscard]] constexpr dimension_code dimension() const noexcept { return dimension_; }
+
+    template<EncodableDimension D>
+    [[nodiscard]] constexpr bool has_dimension() const noexcept { return dimension_ == dimension_code_of<D>; }
+
+    [[nodiscard]] friend constexpr any_quantity operator*(const any_quantity& lhs, const any_quantity& rhs) noexcept
+    {
+      return any_quantity(lhs.count() * rhs.count(), lhs.dimension_ * rhs.dimension_, lhs.scale_ * rhs.scale_);
+    }
+
+    [[nodiscard]] friend constexpr any_quantity operator/(const any_quantity& lhs, const any_quantity& rhs) noexcept
+    {
+      return any_quantity(lhs.count() / rhs.count(), lhs.dimension_ / rhs.dimension_, lhs.scale_ / rhs.scale_);
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(const any_quantity& lhs, const any_quantity& rhs) noexcept
+    {
+      return lhs.dimension_ == rhs.dimension_ && lhs.value_ == rhs.value_;
+    }
+
+    [[nodiscard]] friend constexpr bool operator!=(const any_quantity& lhs, const any_quantity& rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+  };
+
+  // any_quantity_cast
+
+  namespace detail {
+
+    // `std::llround()` is not `constexpr`
+    template<typename T>
+    [[nodiscard]] constexpr T round_to_nearest(double v) noexcept
+    {
+      // doubles of this magnitude are integers already
+      if(!(v > -0x1p52 && v < 0x1p52))
+        return static_cast<T>(v);
+      const auto t = static_cast<std::int64_t>(v);
+      const double f = v - static_cast<double>(t);  // exact
+      return static_cast<T>(f >= 0.5 ? t + 1 : f <= -0.5 ? t - 1 : t);
+    }
+
+  }  // namespace detail
+
+  template<Quantity To>
+  [[nodiscard]] constexpr To any_quantity_cast(const any_quantity& q)
+      requires EncodableDimension<typename To::dimension>
+  {
+    using r = typename To::unit::ratio;
+    constexpr double inverse_ratio = static_cast<double>(r::den) / static_cast<double>(r::num);
+
+    if(q.dimension() != dimension_code_of<typename To::dimension>)
+      throw bad_any_quantity_cast();
+    const double v = q.coherent_count() * inverse_ratio;
+    if constexpr(std::is_integral_v<typename To::rep>)
+      return To(detail::round_to_nearest<typename To::rep>(v));
+    else
+      return To(static_cast<typename To::rep>(v));
+  }
+
+}  // namespace units
@@ -0,0 +1,130 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/quantity.h>
+#include <atomic>
+#include <concepts>
+
+namespace units {
+
+  namespace detail {
+
+    // Integral types have a native `fetch_add`, other representations (floating-point or user-defined
+    // types) fall back to a CAS loop
+    template<typename Rep>
+    Rep atomic_fetch_add(std::atomic<Rep>& a, Rep delta, std::memory_order order) noexcept
+    {
+      if constexpr(std::integral<Rep>) {
+        return a.fetch_add(delta, order);
+      }
+      else {
+        Rep current = a.load(std::memory_order_relaxed);
+        while(!a.compare_exchange_weak(current, current + delta, order, std::memory_order_relaxed)) {
+        }
+        return current;
+      }
+    }
+
+  }  // namespace detail
+
+  // atomic_quantity
+
+  // Atomic storage of a `quantity<U, Rep>`. It has exactly the layout and the lock-freedom of
+  // `std::atomic<Rep>` - the unit lives only in the type.
+  //
+  // Read-modify-write operations accept any quantity of the same dimension that converts to
+  // `quantity<U, Rep>` without loss of precision. The unit conversion is done on the argument before
+  // the atomic operation, so only the plain `Rep` ever touches the shared memory location.
+  template<Unit U, Scalar Rep = double>
+  class atomic_quantity {
+    std::atomic<Rep> value_;
+
+  public:
+    using value_type = quantity<U, Rep>;
+    using unit = U;
+    using rep = Rep;
+    using dimension = U::dimension;
+
+    static constexpr bool is_always_lock_free = std::atomic<Rep>::is_always_lock_free;
+
+    atomic_quantity() noexcept: value_(quantity_values<Rep>::zero()) {}
+    constexpr explicit atomic_quantity(const value_type& q) noexcept: value_(q.count()) {}
+
+    atomic_quantity(const atomic_quantity&) = delete;
+    atomic_quantity& operator=(const atomic_quantity&) = delete;
+    atomic_quantity& operator=(const atomic_quantity&) volatile = delete;
+
+    [[nodiscard]] bool is_lock_free() const noexcept { return value_.is_lock_free(); }
+
+    [[nodiscard]] value_type load(std::memory_order order) const noexcept { return value_type(value_.load(order)); }
+
+    void store(const value_type& q, std::memory_order order) noexcept { value_.store(q.count(), order); }
+
+    [[nodiscard]] value_type exchange(const value_type& q, std::memory_order order) noexcept
+    {
+      return value_type(value_.exchange(q.count(), order));
+    }
+
+    // On failure `expected` is updated with the current value, as in `std::atomic`
+    bool compare_exchange_weak(value_type& expected, const value_type& desired, std::memory_order success,
+                               std::memory_order failure) noexcept
+    {
+      Rep e = expected.count();
+      const bool result = value_.compare_exchange_weak(e, desired.count(), success, failure);
+      expected = value_type(e);
+      return result;
+    }
+
+    bool compare_exchange_strong(value_type& expected, const value_type& desired, std::memory_order success,
+                                 std::memory_order failure) noexcept
+    {
+      Rep e = expected.count();
+      const bool result = value_.compare_exchange_strong(e, desired.count(), success, failure);
+      expected = value_type(e);
+      return result;
+    }
+
+    template<Quantity Q>
+        requires same_dim<dimension, typename Q::dimension> && std::convertible_to<Q, value_type>
+    value_type fetch_add(const Q& q, std::memory_order order) noexcept
+    {
+      return value_type(detail::atomic_fetch_add(value_, to_rep(q), order));
+    }
+
+    template<Quantity Q>
+        requires same_dim<dimension, typename Q::dimension> && std::convertible_to<Q, value_type>
+    value_type fetch_sub(const Q& q, std::memory_order order) noexcept
+    {
+      if constexpr(std::integral<Rep>)
+        return value_type(value_.fetch_sub(to_rep(q), order));
+      else
+        return value_type(detail::atomic_fetch_add(value_, -to_rep(q), order));
+    }
+
+  private:
+    template<Quantity Q>
+    [[nodiscard]] static constexpr Rep to_rep(const Q& q) { return quantity_cast<value_type>(q).count(); }
+  };
+
+}  // namespace units
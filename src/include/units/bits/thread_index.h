@@ -0,0 +1,46 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace units {
+
+  namespace detail {
+
+    // Fixed instead of std::hardware_destructive_interference_size which is not ABI-stable
+    inline constexpr std::size_t cache_line_size = 64;
+
+    // Every thread gets a consecutive number on its first call so that threads are spread evenly over
+    // per-thread slots (shards, reader slots, ...).
+    [[nodiscard]] inline std::size_t this_thread_index() noexcept
+    {
+      static std::atomic<std::size_t> next = 0;
+      thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+      return index;
+    }
+
+  }  // namespace detail
+
+}  // namespace units
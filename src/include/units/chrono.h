@@ -0,0 +1,45 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/dimensions/time.h>
+#include <chrono>
+
+namespace units {
+
+  // std::chrono::duration is a quantity of time with its unit given by `Period`. Periods matching
+  // the units defined in `units/dimensions/time.h` map to those units (i.e. `std::milli` to
+  // `millisecond`) so conversions between the two compile to a plain copy of the count.
+  template<typename Rep, typename Period>
+  struct quantity_like_traits<std::chrono::duration<Rep, Period>> {
+    using unit = downcast<units::unit<time, ratio<Period::num, Period::den>>>;
+    using rep = Rep;
+
+    [[nodiscard]] static constexpr rep count(const std::chrono::duration<Rep, Period>& d) { return d.count(); }
+    [[nodiscard]] static constexpr std::chrono::duration<Rep, Period> make(const rep& r)
+    {
+      return std::chrono::duration<Rep, Period>(r);
+    }
+  };
+
+}  // namespace units
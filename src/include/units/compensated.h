@@ -0,0 +1,222 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/quantity.h>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <type_traits>
+
+namespace units {
+
+  namespace detail {
+
+    // Neumaier's variant of Kahan's summation step: adds `x` to `sum` and accumulates the rounding
+    // error of that addition in `c`. Branch-free so it vectorizes.
+    template<std::floating_point T>
+    constexpr void neumaier_add(T& sum, T& c, T x) noexcept
+    {
+      const T s = sum + x;
+      const bool sum_is_bigger = (sum < 0 ? -sum : sum) >= (x < 0 ? -x : x);
+      c += sum_is_bigger ? (sum - s) + x : (x - s) + sum;
+      sum = s;
+    }
+
+  }  // namespace detail
+
+  // compensated
+
+  // Floating-point representation that carries the rounding error of additions and subtractions in a
+  // second member, so long sums of small values do not drift. Multiplication and division keep the
+  // error term to first order. The represented value is `hi() + lo()`.
+  template<std::floating_point T>
+  class compensated {
+    T hi_ = 0;
+    T lo_ = 0;
+
+    constexpr compensated(T hi, T lo) noexcept: hi_(hi), lo_(lo) {}
+
+  public:
+    using value_type = T;
+
+    compensated() = default;
+    constexpr compensated(T v) noexcept: hi_(v) {}
+
+    template<typename U>
+        requires std::is_arithmetic_v<U> && (!std::same_as<U, T>)
+    constexpr explicit compensated(U v) noexcept: hi_(static_cast<T>(v)) {}
+
+    [[nodiscard]] constexpr T hi() const noexcept { return hi_; }
+    [[nodiscard]] constexpr T lo() const noexcept { return lo_; }
+    [[nodiscard]] constexpr T value() const noexcept { return hi_ + lo_; }
+
+    template<typename U>
+        requires std::is_arithmetic_v<U>
+    constexpr explicit operator U() const noexcept
+    {
+      return static_cast<U>(value());
+    }
+
+    [[nodiscard]] constexpr compensated operator+() const noexcept { return *this; }
+    [[nodiscard]] constexpr compensated operator-() const noexcept { return compensated(-hi_, -lo_); }
+
+    constexpr compensated& operator+=(const compensated& rhs) noexcept
+    {
+      lo_ += rhs.lo_;
+      detail::neumaier_add(hi_, lo_, rhs.hi_);
+      return *this;
+    }
+
+    constexpr compensated& operator-=(const compensated& rhs) noexcept { return *this += -rhs; }
+
+    constexpr compensated& operator*=(const compensated& rhs) noexcept
+    {
+      const T p = hi_ * rhs.hi_;
+      const T e = std::fma(hi_, rhs.hi_, -p);  // exact rounding error of the product
+      lo_ = e + hi_ * rhs.lo_ + lo_ * rhs.hi_;
+      hi_ = p;
+      return *this;
+    }
+
+    constexpr compensated& operator/=(const compensated& rhs) noexcept
+    {
+      const T q = hi_ / rhs.hi_;
+      const T r = std::fma(-q, rhs.hi_, hi_) + lo_ - q * rhs.lo_;  // remainder of the division
+      lo_ = r / rhs.hi_;
+      hi_ = q;
+      return *this;
+    }
+
+    [[nodiscard]] friend constexpr compensated operator+(compensated lhs, const compensated& rhs) noexcept { return lhs += rhs; }
+    [[nodiscard]] friend constexpr compensated operator-(compensated lhs, const compensated& rhs) noexcept { return lhs -= rhs; }
+    [[nodiscard]] friend constexpr compensated operator*(compensated lhs, const compensated& rhs) noexcept { return lhs *= rhs; }
+    [[nodiscard]] friend constexpr compensated operator/(compensated lhs, const compensated& rhs) noexcept { return lhs /= rhs; }
+
+    [[nodiscard]] friend constexpr bool operator==(const compensated& lhs, const compensated& rhs) noexcept
+    {
+      return lhs.value() == rhs.value();
+    }
+
+    [[nodiscard]] friend constexpr std::partial_ordering operator<=>(const compensated& lhs, const compensated& rhs) noexcept
+    {
+      return lhs.value() <=> rhs.value();
+    }
+
+    template<class CharT, class Traits>
+    friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const compensated& v)
+    {
+      return os << v.value();
+    }
+  };
+
+  template<typename T>
+  inline constexpr bool treat_as_floating_point<compensated<T>> = true;
+
+  template<typename T>
+  struct quantity_values<compensated<T>> {
+    static constexpr compensated<T> zero() noexcept { return compensated<T>(0); }
+    static constexpr compensated<T> one() noexcept { return compensated<T>(1); }
+    static constexpr compensated<T> max() noexcept { return compensated<T>(std::numeric_limits<T>::max()); }
+    static constexpr compensated<T> min() noexcept { return compensated<T>(std::numeric_limits<T>::lowest()); }
+  };
+
+  // compensated_sum
+
+  // Accumulator of floating-point quantities with Neumaier summation. Inputs are converted to `Q` with
+  // a compile-time `quantity_cast`; only quantities whose `common_quantity` with `Q` is `Q` itself are
+  // accepted, so the conversion never loses precision.
+  template<Quantity Q>
+      requires std::floating_point<typename Q::rep>
+  class compensated_sum {
+  public:
+    using value_type = Q;
+    using rep = Q::rep;
+
+  private:
+    rep sum_ = 0;
+    rep c_ = 0;
+
+  public:
+    template<Quantity Q2>
+        requires same_dim<typename Q::dimension, typename Q2::dimension> &&
+                 std::same_as<common_quantity<value_type, Q2, rep>, value_type>
+    constexpr void add(const Q2& q) noexcept
+    {
+      detail::neumaier_add(sum_, c_, quantity_cast<value_type>(q).count());
+    }
+
+    // Batch update with independent lanes, each being a Neumaier sum, so the loop vectorizes
+    void add(std::span<const value_type> xs) noexcept
+    {
+      constexpr std::size_t lanes = 4;
+      const std::size_t n = xs.size();
+      const std::size_t tail = n - n % lanes;
+
+      rep sum[lanes] = {};
+      rep c[lanes] = {};
+      for(std::size_t i = 0; i < tail; i += lanes)
+        for(std::size_t l = 0; l < lanes; ++l) detail::neumaier_add(sum[l], c[l], xs[i + l].count());
+      for(std::size_t i = tail; i < n; ++i) detail::neumaier_add(sum[0], c[0], xs[i].count());
+
+      for(std::size_t l = 0; l < lanes; ++l) {
+        c_ += c[l];
+        detail::neumaier_add(sum_, c_, sum[l]);
+      }
+    }
+
+    constexpr void merge(const compensated_sum& other) noexcept
+    {
+      c_ += other.c_;
+      detail::neumaier_add(sum_, c_, other.sum_);
+    }
+
+    [[nodiscard]] constexpr value_type value() const noexcept { return value_type(sum_ + c_); }
+  };
+
+}  // namespace units
+
+namespace std {
+
+  template<typename T, typename U>
+      requires is_arithmetic_v<U>
+  struct common_type<units::compensated<T>, U> {
+    using type = units::compensated<common_type_t<T, U>>;
+  };
+
+  template<typename T, typename U>
+      requires is_arithmetic_v<T>
+  struct common_type<T, units::compensated<U>> {
+    using type = units::compensated<common_type_t<T, U>>;
+  };
+
+  template<typename T, typename U>
+  struct common_type<units::compensated<T>, units::compensated<U>> {
+    using type = units::compensated<common_type_t<T, U>>;
+  };
+
+}  // namespace std
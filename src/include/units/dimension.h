@@ -272,15 +272,16 @@ namespace units {
   // dimension_pow
   namespace detail {
 
-    template<typename D, std::size_t N>
+    template<typename D, int Num, int Den>
     struct dimension_pow_impl;
 
-    template<typename... Es, std::size_t N>
-    struct dimension_pow_impl<dimension<Es...>, N> : std::type_identity<downcast<dimension<exp_multiply<Es, N, 1>...>>> {};
+    template<typename... Es, int Num, int Den>
+    struct dimension_pow_impl<dimension<Es...>, Num, Den> : std::type_identity<downcast<dimension<exp_multiply<Es, Num, Den>...>>> {};
 
   }
 
-  template<Dimension D, std::size_t N>
-  using dimension_pow = detail::dimension_pow_impl<typename D::base_type, N>::type;
+  // D^(Num/Den)
+  template<Dimension D, int Num, int Den = 1>
+  using dimension_pow = detail::dimension_pow_impl<typename D::base_type, Num, Den>::type;
 
 }  // namespace units
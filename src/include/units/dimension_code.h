@@ -0,0 +1,192 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/dimensions/si_base_dimensions.h>
+#include <units/dimension.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace units {
+
+  // dimension_code
+
+  namespace detail {
+
+    [[nodiscard]] constexpr std::uint64_t replicate_field(std::uint64_t field, std::size_t field_bits, std::size_t count) noexcept
+    {
+      std::uint64_t ret = 0;
+      for(std::size_t i = 0; i != count; ++i)
+        ret |= field << (i * field_bits);
+      return ret;
+    }
+
+  }  // namespace detail
+
+  // Runtime representation of a dimension built from SI base dimensions. Exponents of every base dimension
+  // are stored as 9-bit two's complement multiples of 1/12 packed into a single 64-bit word so that
+  // multiplication and division of dimensions are lane-wise (SWAR) additions and subtractions and equality
+  // is a single integer compare.
+  class dimension_code {
+    static constexpr int field_bits = 9;
+    static constexpr std::uint64_t field_mask = (std::uint64_t(1) << field_bits) - 1;
+
+    static constexpr std::uint64_t used_bits = detail::replicate_field(field_mask, field_bits, 7);
+    static constexpr std::uint64_t high_bits = detail::replicate_field(std::uint64_t(1) << (field_bits - 1), field_bits, 7);
+
+    std::uint64_t bits_ = 0;
+
+    constexpr explicit dimension_code(std::uint64_t bits) noexcept: bits_(bits & used_bits) {}
+
+  public:
+    static constexpr std::size_t base_dimension_count = 7;
+    static constexpr int exponent_scale = 12;
+    static constexpr int max_scaled_exponent = (1 << (field_bits - 1)) - 1;
+    static constexpr int min_scaled_exponent = -(1 << (field_bits - 1));
+
+    dimension_code() = default;
+
+    [[nodiscard]] static constexpr dimension_code from_bits(std::uint64_t bits) noexcept { return dimension_code(bits); }
+
+    [[nodiscard]] static constexpr dimension_code from_exponent(std::size_t index, int num, int den = 1) noexcept
+    {
+      Expects(index < base_dimension_count);
+      Expects(den > 0 && (num * exponent_scale) % den == 0);
+      const int scaled = num * exponent_scale / den;
+      Expects(min_scaled_exponent <= scaled && scaled <= max_scaled_exponent);
+      return dimension_code((static_cast<std::uint64_t>(scaled) & field_mask) << (index * field_bits));
+    }
+
+    [[nodiscard]] constexpr std::uint64_t bits() const noexcept { return bits_; }
+
+    [[nodiscard]] constexpr int scaled_exponent(std::size_t index) const noexcept
+    {
+      const int field = static_cast<int>((bits_ >> (index * field_bits)) & field_mask);
+      return field > max_scaled_exponent ? field - (1 << field_bits) : field;
+    }
+
+    [[nodiscard]] constexpr bool is_dimensionless() const noexcept { return bits_ == 0; }
+
+  private:
+    [[nodiscard]] static constexpr std::uint64_t multiply_bits(std::uint64_t lhs, std::uint64_t rhs) noexcept
+    {
+      return ((lhs & ~high_bits) + (rhs & ~high_bits)) ^ ((lhs ^ rhs) & high_bits);
+    }
+
+    [[nodiscard]] static constexpr std::uint64_t divide_bits(std::uint64_t lhs, std::uint64_t rhs) noexcept
+    {
+      return ((lhs | high_bits) - (rhs & ~high_bits)) ^ ((lhs ^ ~rhs) & high_bits);
+    }
+
+  public:
+    // The exponents of the result of `*` and `/` must fit in their fields, otherwise they would wrap around.
+    // A field overflows when the sign of the result differs from the sign of the left operand although the
+    // signs of the operands are the same (`*`) or different (`/`).
+    [[nodiscard]] friend constexpr bool multiplication_overflows(dimension_code lhs, dimension_code rhs) noexcept
+    {
+      const std::uint64_t ret = multiply_bits(lhs.bits_, rhs.bits_);
+      return (~(lhs.bits_ ^ rhs.bits_) & (lhs.bits_ ^ ret) & high_bits) != 0;
+    }
+
+    [[nodiscard]] friend constexpr bool division_overflows(dimension_code lhs, dimension_code rhs) noexcept
+    {
+      const std::uint64_t ret = divide_bits(lhs.bits_, rhs.bits_);
+      return ((lhs.bits_ ^ rhs.bits_) & (lhs.bits_ ^ ret) & high_bits) != 0;
+    }
+
+    [[nodiscard]] friend constexpr dimension_code operator*(dimension_code lhs, dimension_code rhs) noexcept
+    {
+      Expects(!multiplication_overflows(lhs, rhs));
+      return dimension_code(multiply_bits(lhs.bits_, rhs.bits_));
+    }
+
+    [[nodiscard]] friend constexpr dimension_code operator/(dimension_code lhs, dimension_code rhs) noexcept
+    {
+      Expects(!division_overflows(lhs, rhs));
+      return dimension_code(divide_bits(lhs.bits_, rhs.bits_));
+    }
+
+    [[nodiscard]] friend constexpr dimension_code pow(dimension_code d, int num, int den = 1) noexcept
+    {
+      dimension_code ret;
+      for(std::size_t i = 0; i != base_dimension_count; ++i)
+        ret = ret * from_exponent(i, d.scaled_exponent(i) * num, den * exponent_scale);
+      return ret;
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(dimension_code lhs, dimension_code rhs) noexcept { return lhs.bits_ == rhs.bits_; }
+    [[nodiscard]] friend constexpr bool operator!=(dimension_code lhs, dimension_code rhs) noexcept { return !(lhs == rhs); }
+  };
+
+  // si_base_dimension_index
+
+  namespace detail {
+
+    template<typename BD>
+    inline constexpr std::size_t si_base_dimension_index = dimension_code::base_dimension_count;
+
+    template<> inline constexpr std::size_t si_base_dimension_index<base_dim_length> = 0;
+    template<> inline constexpr std::size_t si_base_dimension_index<base_dim_mass> = 1;
+    template<> inline constexpr std::size_t si_base_dimension_index<base_dim_time> = 2;
+    template<> inline constexpr std::size_t si_base_dimension_index<base_dim_current> = 3;
+    template<> inline constexpr std::size_t si_base_dimension_index<base_dim_temperature> = 4;
+    template<> inline constexpr std::size_t si_base_dimension_index<base_dim_substance> = 5;
+    template<> inline constexpr std::size_t si_base_dimension_index<base_dim_luminous_intensity> = 6;
+
+  }  // namespace detail
+
+  // dimension_code_of
+
+  namespace detail {
+
+    template<typename E>
+    inline constexpr bool is_encodable_exp =
+        si_base_dimension_index<typename E::dimension> != dimension_code::base_dimension_count &&
+        (E::num * dimension_code::exponent_scale) % E::den == 0 &&
+        dimension_code::min_scaled_exponent <= E::num * dimension_code::exponent_scale / E::den &&
+        E::num * dimension_code::exponent_scale / E::den <= dimension_code::max_scaled_exponent;
+
+    template<typename D>
+    inline constexpr bool is_encodable_dimension = false;
+
+    template<typename... Es>
+    inline constexpr bool is_encodable_dimension<dimension<Es...>> = (is_encodable_exp<Es> && ...);
+
+    template<typename D>
+    struct dimension_code_of_impl;
+
+    template<typename... Es>
+    struct dimension_code_of_impl<dimension<Es...>> {
+      static constexpr dimension_code value =
+          (dimension_code() * ... * dimension_code::from_exponent(si_base_dimension_index<typename Es::dimension>, Es::num, Es::den));
+    };
+
+  }  // namespace detail
+
+  template<typename D>
+  concept EncodableDimension = Dimension<D> && detail::is_encodable_dimension<typename D::base_type>;
+
+  template<EncodableDimension D>
+  inline constexpr dimension_code dimension_code_of = detail::dimension_code_of_impl<typename D::base_type>::value;
+
+}  // namespace units
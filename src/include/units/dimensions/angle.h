@@ -0,0 +1,61 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/dimensions/si_prefixes.h>
+#include <units/quantity.h>
+
+namespace units {
+
+  // SI treats the radian as dimensionless. Here the plane angle is a base dimension, so that angles
+  // cannot be mixed up with other dimensionless values and trigonometric functions can require them.
+  struct base_dim_angle : base_dimension<"angle", "rad"> {};
+
+  struct angle : derived_dimension<angle, exp<base_dim_angle, 1>> {};
+
+  template<typename T>
+  concept Angle = QuantityOf<T, angle>;
+
+  struct radian : named_coherent_derived_unit<radian, "rad", angle, si_prefix> {};
+  struct milliradian : prefixed_derived_unit<milliradian, milli, radian> {};
+
+  // pi/180 approximated with the 245850922/78256779 convergent of pi (relative error 2.5e-17)
+  struct degree : named_derived_unit<degree, "°", angle, ratio<122925461, 7043110110>> {};
+
+  inline namespace literals {
+
+    // rad
+    constexpr auto operator""rad(unsigned long long l) { return quantity<radian, std::int64_t>(l); }
+    constexpr auto operator""rad(long double l) { return quantity<radian, long double>(l); }
+
+    // mrad
+    constexpr auto operator""mrad(unsigned long long l) { return quantity<milliradian, std::int64_t>(l); }
+    constexpr auto operator""mrad(long double l) { return quantity<milliradian, long double>(l); }
+
+    // deg
+    constexpr auto operator""deg(unsigned long long l) { return quantity<degree, std::int64_t>(l); }
+    constexpr auto operator""deg(long double l) { return quantity<degree, long double>(l); }
+
+  }  // namespace literals
+
+}  // namespace units
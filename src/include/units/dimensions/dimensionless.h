@@ -0,0 +1,41 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/quantity.h>
+
+namespace units {
+
+  // Quantities of dimension one. A quotient of two quantities of the same dimension is a plain
+  // `Scalar`; `dimensionless` gives such values a type when a unit other than one is needed.
+  struct dimensionless : derived_dimension<dimensionless> {};
+
+  template<typename T>
+  concept Dimensionless = QuantityOf<T, dimensionless>;
+
+  struct one : named_coherent_derived_unit<one, "", dimensionless> {};
+  struct percent : named_derived_unit<percent, "%", dimensionless, ratio<1, 100>> {};
+  struct per_mille : named_derived_unit<per_mille, "‰", dimensionless, ratio<1, 1000>> {};
+  struct parts_per_million : named_derived_unit<parts_per_million, "ppm", dimensionless, ratio<1, 1'000'000>> {};
+
+}  // namespace units
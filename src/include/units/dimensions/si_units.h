@@ -0,0 +1,74 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/bits/unit_list.h>
+#include <units/dimensions/acceleration.h>
+#include <units/dimensions/area.h>
+#include <units/dimensions/capacitance.h>
+#include <units/dimensions/current.h>
+#include <units/dimensions/electric_charge.h>
+#include <units/dimensions/energy.h>
+#include <units/dimensions/force.h>
+#include <units/dimensions/frequency.h>
+#include <units/dimensions/length.h>
+#include <units/dimensions/luminous_intensity.h>
+#include <units/dimensions/mass.h>
+#include <units/dimensions/power.h>
+#include <units/dimensions/pressure.h>
+#include <units/dimensions/substance.h>
+#include <units/dimensions/surface_tension.h>
+#include <units/dimensions/temperature.h>
+#include <units/dimensions/time.h>
+#include <units/dimensions/velocity.h>
+#include <units/dimensions/voltage.h>
+#include <units/dimensions/volume.h>
+
+namespace units {
+
+  // all the predefined units that have a unique symbol
+  using si_units = unit_list<
+      // base dimensions
+      metre, millimetre, centimetre, kilometre, yard, foot, inch, mile,
+      gram, kilogram,
+      second, nanosecond, microsecond, millisecond, minute, hour,
+      ampere,
+      kelvin,
+      mole,
+      candela,
+      // derived dimensions
+      square_metre,
+      cubic_metre,
+      metre_per_second,
+      metre_per_second_sq,
+      hertz, millihertz, kilohertz, megahertz, gigahertz, terahertz,
+      newton,
+      pascal,
+      joule, millijoule, kilojoule, megajoule, gigajoule,
+      watt, milliwatt, kilowatt, megawatt, gigawatt,
+      coulomb,
+      volt,
+      farad,
+      newton_per_metre>;
+
+}  // namespace units
@@ -0,0 +1,215 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/bits/quantity_range.h>
+#include <units/quantity.h>
+#include <cstddef>
+#include <ranges>
+#include <type_traits>
+
+namespace units {
+
+  namespace detail {
+
+    // Integrals and derivatives are computed in floating-point even for integral samples
+    template<Quantity Y, Quantity T>
+    using calculus_rep = std::conditional_t<treat_as_floating_point<std::common_type_t<typename Y::rep, typename T::rep>>,
+                                            std::common_type_t<typename Y::rep, typename T::rep>, double>;
+
+    // `Y * T` and `Y / T` as quantities, also when the result is dimensionless
+    template<Quantity Y, Quantity T>
+    using integral_quantity = quantity<downcast<unit<dimension_multiply<typename Y::dimension, typename T::dimension>,
+                                                     ratio_multiply<typename Y::unit::ratio, typename T::unit::ratio>>>,
+                                       calculus_rep<Y, T>>;
+
+    template<Quantity Y, Quantity T>
+    using derivative_quantity = quantity<downcast<unit<dimension_divide<typename Y::dimension, typename T::dimension>,
+                                                       ratio_divide<typename Y::unit::ratio, typename T::unit::ratio>>>,
+                                         calculus_rep<Y, T>>;
+
+    // Sum of `term(i)` for `i` in [0, n) in independent lanes so that the reduction vectorizes
+    // without reassociating floating-point additions
+    template<typename Rep, typename F>
+    [[nodiscard]] constexpr Rep lane_sum(std::size_t n, F term) noexcept
+    {
+      constexpr std::size_t lanes = 4;
+      const std::size_t tail = n - n % lanes;
+      Rep sum[lanes] = {};
+      for(std::size_t i = 0; i < tail; i += lanes)
+        for(std::size_t l = 0; l < lanes; ++l) sum[l] += term(i + l);
+      for(std::size_t i = tail; i < n; ++i) sum[0] += term(i);
+      return (sum[0] + sum[1]) + (sum[2] + sum[3]);
+    }
+
+  }  // namespace detail
+
+  // Integration and differentiation of sampled functions `y(t)`. The samples are given as contiguous
+  // ranges of quantities (one range of `y` and either a range of `t` or a constant spacing `dt`). The
+  // integral of `Y` over `T` has the dimension `dimension_multiply<Y, T>` (`watt` over `second` gives
+  // `joule`), the derivative `dimension_divide<Y, T>` (`metre` over `second` gives `metre_per_second`).
+  // Every function makes a single pass over the samples; the uniformly spaced variants vectorize.
+
+  // trapezoid
+
+  template<typename Ys, Quantity T>
+  [[nodiscard]] constexpr auto trapezoid(const Ys& y, const T& dt) noexcept
+    requires detail::QuantityRange<Ys>
+  {
+    using ret = detail::integral_quantity<std::ranges::range_value_t<Ys>, T>;
+    using rep = ret::rep;
+    const std::size_t n = std::ranges::size(y);
+    if(n < 2) return ret(0);
+    const auto v = std::ranges::data(y);
+    const rep inner = detail::lane_sum<rep>(n - 2, [&](std::size_t i) { return static_cast<rep>(v[i + 1].count()); });
+    const rep ends = (static_cast<rep>(v[0].count()) + static_cast<rep>(v[n - 1].count())) / 2;
+    return ret((ends + inner) * static_cast<rep>(dt.count()));
+  }
+
+  template<typename Ts, typename Ys>
+  [[nodiscard]] constexpr auto trapezoid(const Ts& t, const Ys& y) noexcept
+    requires detail::QuantityRange<Ts> && detail::QuantityRange<Ys>
+  {
+    using ret = detail::integral_quantity<std::ranges::range_value_t<Ys>, std::ranges::range_value_t<Ts>>;
+    using rep = ret::rep;
+    const std::size_t n = std::ranges::size(y);
+    Expects(std::ranges::size(t) == n);
+    if(n < 2) return ret(0);
+    const auto tv = std::ranges::data(t);
+    const auto yv = std::ranges::data(y);
+    const rep sum = detail::lane_sum<rep>(n - 1, [&](std::size_t i) {
+      return (static_cast<rep>(tv[i + 1].count()) - static_cast<rep>(tv[i].count())) *
+             (static_cast<rep>(yv[i].count()) + static_cast<rep>(yv[i + 1].count()));
+    });
+    return ret(sum / 2);
+  }
+
+  // simpson
+
+  // Composite Simpson's rule for uniformly spaced samples. For an odd number of intervals the last
+  // three are integrated with Simpson's 3/8 rule; two samples fall back to the trapezoid rule.
+  template<typename Ys, Quantity T>
+  [[nodiscard]] constexpr auto simpson(const Ys& y, const T& dt) noexcept
+    requires detail::QuantityRange<Ys>
+  {
+    using ret = detail::integral_quantity<std::ranges::range_value_t<Ys>, T>;
+    using rep = ret::rep;
+    const std::size_t n = std::ranges::size(y);
+    if(n < 3) return trapezoid(y, dt);
+    const auto v = std::ranges::data(y);
+    const auto at = [&](std::size_t i) { return static_cast<rep>(v[i].count()); };
+
+    // y[0] + 4 y[1] + 2 y[2] + ... + 4 y[k-1] + y[k] over an even number k of intervals
+    const std::size_t k = (n - 1) % 2 == 0 ? n - 1 : n - 4;
+    rep sum = 0;
+    if(k > 0)
+      sum = at(0) - at(k) + detail::lane_sum<rep>(k / 2, [&](std::size_t j) { return 4 * at(2 * j + 1) + 2 * at(2 * j + 2); });
+    sum /= 3;
+    if(k != n - 1) sum += rep(3) / 8 * (at(n - 4) + 3 * at(n - 3) + 3 * at(n - 2) + at(n - 1));
+    return ret(sum * static_cast<rep>(dt.count()));
+  }
+
+  // derivative
+
+  // Second-order central differences inside and first-order one-sided differences at both ends,
+  // written to the first `size(y)` elements of `out`
+  template<typename Ys, Quantity T, typename Out>
+    requires detail::QuantityRange<Ys> && std::ranges::contiguous_range<Out> && std::ranges::sized_range<Out> &&
+             std::is_assignable_v<std::ranges::range_reference_t<Out>,
+                                  detail::derivative_quantity<std::ranges::range_value_t<Ys>, T>>
+  constexpr void derivative(const Ys& y, const T& dt, Out&& out) noexcept
+  {
+    using ret = detail::derivative_quantity<std::ranges::range_value_t<Ys>, T>;
+    using rep = ret::rep;
+    const std::size_t n = std::ranges::size(y);
+    Expects(n >= 2 && std::ranges::size(out) >= n);
+    const auto v = std::ranges::data(y);
+    const auto dst = std::ranges::data(out);
+    const rep inv_dt = 1 / static_cast<rep>(dt.count());
+    const rep inv_2dt = inv_dt / 2;
+    dst[0] = ret((static_cast<rep>(v[1].count()) - static_cast<rep>(v[0].count())) * inv_dt);
+    for(std::size_t i = 1; i < n - 1; ++i)
+      dst[i] = ret((static_cast<rep>(v[i + 1].count()) - static_cast<rep>(v[i - 1].count())) * inv_2dt);
+    dst[n - 1] = ret((static_cast<rep>(v[n - 1].count()) - static_cast<rep>(v[n - 2].count())) * inv_dt);
+  }
+
+  // Non-uniform spacing; the inner points use the second-order three-point formula
+  template<typename Ts, typename Ys, typename Out>
+    requires detail::QuantityRange<Ts> && detail::QuantityRange<Ys> && std::ranges::contiguous_range<Out> &&
+             std::ranges::sized_range<Out> &&
+             std::is_assignable_v<std::ranges::range_reference_t<Out>,
+                                  detail::derivative_quantity<std::ranges::range_value_t<Ys>, std::ranges::range_value_t<Ts>>>
+  constexpr void derivative(const Ts& t, const Ys& y, Out&& out) noexcept
+  {
+    using ret = detail::derivative_quantity<std::ranges::range_value_t<Ys>, std::ranges::range_value_t<Ts>>;
+    using rep = ret::rep;
+    const std::size_t n = std::ranges::size(y);
+    Expects(n >= 2 && std::ranges::size(t) == n && std::ranges::size(out) >= n);
+    const auto tv = std::ranges::data(t);
+    const auto yv = std::ranges::data(y);
+    const auto dst = std::ranges::data(out);
+    const auto t_at = [&](std::size_t i) { return static_cast<rep>(tv[i].count()); };
+    const auto y_at = [&](std::size_t i) { return static_cast<rep>(yv[i].count()); };
+    dst[0] = ret((y_at(1) - y_at(0)) / (t_at(1) - t_at(0)));
+    for(std::size_t i = 1; i < n - 1; ++i) {
+      const rep hs = t_at(i) - t_at(i - 1);
+      const rep hd = t_at(i + 1) - t_at(i);
+      dst[i] = ret((hs * hs * y_at(i + 1) + (hd * hd - hs * hs) * y_at(i) - hd * hd * y_at(i - 1)) /
+                   (hs * hd * (hd + hs)));
+    }
+    dst[n - 1] = ret((y_at(n - 1) - y_at(n - 2)) / (t_at(n - 1) - t_at(n - 2)));
+  }
+
+  // trapezoid_integrator
+
+  // Running trapezoid integral of samples `(t, y)` that arrive one at a time, e.g. power readings
+  // accumulated into energy
+  template<Quantity T, Quantity Y>
+  class trapezoid_integrator {
+  public:
+    using time_type = T;
+    using value_type = Y;
+    using result_type = detail::integral_quantity<Y, T>;
+    using rep = result_type::rep;
+
+  private:
+    rep sum_ = 0;  // twice the integral
+    rep last_t_ = 0;
+    rep last_y_ = 0;
+    bool started_ = false;
+
+  public:
+    constexpr void add(const time_type& t, const value_type& y) noexcept
+    {
+      const auto tv = static_cast<rep>(t.count());
+      const auto yv = static_cast<rep>(y.count());
+      if(started_) sum_ += (tv - last_t_) * (yv + last_y_);
+      last_t_ = tv;
+      last_y_ = yv;
+      started_ = true;
+    }
+
+    [[nodiscard]] constexpr result_type value() const noexcept { return result_type(sum_ / 2); }
+  };
+
+}  // namespace units
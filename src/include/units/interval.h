@@ -0,0 +1,375 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/quantity.h>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+namespace units {
+
+  namespace detail {
+
+    // Neighbours of a floating-point value. `float` and `double` step their bit pattern, which is
+    // `constexpr` and written with selects only so that loops over intervals vectorize; other types
+    // use `std::nextafter`.
+    template<std::floating_point T>
+    [[nodiscard]] constexpr T next_up(T x) noexcept
+    {
+      using bits_t = std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>;
+      if constexpr(std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8)) {
+        const auto bits = std::bit_cast<bits_t>(x);
+        const bits_t negative = bits >> (sizeof(T) * 8 - 1);
+        const T stepped = std::bit_cast<T>(bits + 1 - 2 * negative);
+        const T r = x == 0 ? std::numeric_limits<T>::denorm_min() : stepped;
+        return x == x && x != std::numeric_limits<T>::infinity() ? r : x;
+      }
+      else {
+        return std::nextafter(x, std::numeric_limits<T>::infinity());
+      }
+    }
+
+    // `c ? a : b` with bit masks; a select on the sign of an interval bound is otherwise turned into
+    // branches by jump threading, which keeps loops over intervals from being vectorized
+    template<std::floating_point T>
+    [[nodiscard]] constexpr T select(bool c, T a, T b) noexcept
+    {
+      using bits_t = std::conditional_t<sizeof(T) == 8, std::uint64_t, std::uint32_t>;
+      if constexpr(std::numeric_limits<T>::is_iec559 && (sizeof(T) == 4 || sizeof(T) == 8)) {
+        const bits_t mask = bits_t(0) - bits_t(c);
+        return std::bit_cast<T>((std::bit_cast<bits_t>(a) & mask) | (std::bit_cast<bits_t>(b) & ~mask));
+      }
+      else {
+        return c ? a : b;
+      }
+    }
+
+    template<std::floating_point T>
+    [[nodiscard]] constexpr T next_down(T x) noexcept
+    {
+      return -next_up(-x);
+    }
+
+    // Exact errors of the rounded-to-nearest operations, i.e. `(a op b) - r` (Knuth's TwoSum and
+    // Dekker's product at compile time, a fused multiply-add at run time)
+    template<std::floating_point T>
+    [[nodiscard]] constexpr T sum_error(T a, T b, T s) noexcept
+    {
+      const T bb = s - a;
+      return (a - (s - bb)) + (b - bb);
+    }
+
+    template<std::floating_point T>
+    [[nodiscard]] constexpr T product_error(T a, T b, T p) noexcept
+    {
+      if(std::is_constant_evaluated()) {
+        constexpr T split = static_cast<T>((std::uint64_t(1) << ((std::numeric_limits<T>::digits + 1) / 2)) + 1);
+        const T ca = split * a;
+        const T a_hi = ca - (ca - a);
+        const T a_lo = a - a_hi;
+        const T cb = split * b;
+        const T b_hi = cb - (cb - b);
+        const T b_lo = b - b_hi;
+        return ((a_hi * b_hi - p) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo;
+      }
+      else {
+        return std::fma(a, b, -p);
+      }
+    }
+
+    // Exact remainder `a - q * b` of a quotient `q` rounded to nearest
+    template<std::floating_point T>
+    [[nodiscard]] constexpr T quotient_remainder(T a, T b, T q) noexcept
+    {
+      if(std::is_constant_evaluated()) {
+        const T p = q * b;
+        return (a - p) - product_error(q, b, p);
+      }
+      else {
+        return std::fma(-q, b, a);
+      }
+    }
+
+    // Rounding of a result `r` towards minus or plus infinity given the sign of its exact error `e`.
+    // A result that overflowed, or an inexact one that is not normal (the error might then be
+    // inexact too), is always moved outwards.
+    template<std::floating_point T>
+    [[nodiscard]] constexpr T round_down(T r, T e, bool unreliable) noexcept
+    {
+      const T moved = next_down(r);
+      return (e < 0) | unreliable ? moved : r;
+    }
+
+    template<std::floating_point T>
+    [[nodiscard]] constexpr T round_up(T r, T e, bool unreliable) noexcept
+    {
+      const T moved = next_up(r);
+      return (e > 0) | unreliable ? moved : r;
+    }
+
+    template<std::floating_point T>
+    [[nodiscard]] constexpr bool is_finite(T x) noexcept
+    {
+      return x - x == 0;
+    }
+
+    template<std::floating_point T>
+    [[nodiscard]] constexpr bool overflowed(T a, T b, T r) noexcept
+    {
+      return !is_finite(r) & is_finite(a) & is_finite(b);
+    }
+
+    template<std::floating_point T>
+    [[nodiscard]] constexpr T magnitude(T x) noexcept
+    {
+      return x < 0 ? -x : x;
+    }
+
+    template<std::floating_point T>
+    [[nodiscard]] constexpr bool tiny(T r) noexcept
+    {
+      return magnitude(r) < std::numeric_limits<T>::min();
+    }
+
+    template<std::floating_point T>
+    [[nodiscard]] constexpr T add_down(T a, T b) noexcept
+    {
+      const T s = a + b;
+      return round_down(s, sum_error(a, b, s), overflowed(a, b, s));
+    }
+
+    template<std::floating_point T>
+    [[nodiscard]] constexpr T add_up(T a, T b) noexcept
+    {
+      const T s = a + b;
+      return round_up(s, sum_error(a, b, s), overflowed(a, b, s));
+    }
+
+    template<std::floating_point T>
+    [[nodiscard]] constexpr T mul_down(T a, T b) noexcept
+    {
+      const T p = a * b;
+      const T e = product_error(a, b, p);
+      const bool unreliable = overflowed(a, b, p) | (tiny(p) & (std::min(magnitude(a), magnitude(b)) != 0));
+      return round_down(p, e, unreliable);
+    }
+
+    template<std::floating_point T>
+    [[nodiscard]] constexpr T mul_up(T a, T b) noexcept
+    {
+      const T p = a * b;
+      const T e = product_error(a, b, p);
+      const bool unreliable = overflowed(a, b, p) | (tiny(p) & (std::min(magnitude(a), magnitude(b)) != 0));
+      return round_up(p, e, unreliable);
+    }
+
+    // The exact quotient is `q + rem / b`
+    template<std::floating_point T>
+    [[nodiscard]] constexpr T div_down(T a, T b) noexcept
+    {
+      const T q = a / b;
+      const T rem = quotient_remainder(a, b, q);
+      const T e = b < 0 ? -rem : rem;
+      return round_down(q, e, overflowed(a, b, q) | (tiny(q) & (a != 0)));
+    }
+
+    template<std::floating_point T>
+    [[nodiscard]] constexpr T div_up(T a, T b) noexcept
+    {
+      const T q = a / b;
+      const T rem = quotient_remainder(a, b, q);
+      const T e = b < 0 ? -rem : rem;
+      return round_up(q, e, overflowed(a, b, q) | (tiny(q) & (a != 0)));
+    }
+
+  }  // namespace detail
+
+  // interval
+
+  // Representation type that holds a closed interval `[lower, upper]` guaranteed to contain the exact
+  // result of every computation made with it. Each bound is computed in the default rounding mode and,
+  // if the exact error of that operation (obtained with error-free transformations) points outwards,
+  // moved by one ulp. This gives the same bounds as directed rounding without switching the floating-
+  // point rounding mode, so interval arrays can be processed in bulk at the speed of ordinary code.
+  //
+  // Conversions of integers to `interval` are rounded outwards too, so `quantity_cast` of an interval
+  // quantity gives guaranteed bounds also for ratios that are not exactly representable.
+  //
+  // Intervals are only partially ordered: `a < b` when every value of `a` is less than every value of
+  // `b`. Division by an interval containing zero gives the whole real line.
+  template<std::floating_point T>
+  class interval {
+    T lower_ = 0;
+    T upper_ = 0;
+
+  public:
+    using value_type = T;
+
+    interval() = default;
+    constexpr interval(T v) noexcept: lower_(v), upper_(v) {}
+
+    constexpr interval(T lower, T upper) noexcept: lower_(lower), upper_(upper) { Expects(lower <= upper); }
+
+    template<typename U>
+        requires std::is_arithmetic_v<U> && (!std::same_as<U, T>)
+    constexpr explicit interval(U v) noexcept
+    {
+      // `c` is the nearest value to `v`, so `v` lies between `c` and one of its neighbours
+      const T c = static_cast<T>(v);
+      bool above = false;
+      bool below = false;
+      if constexpr(std::integral<U>) {
+        // `c` may be rounded up to `max() + 1` that is outside of `U`
+        const bool in_range = c < static_cast<T>(std::numeric_limits<U>::max());
+        above = !in_range || static_cast<U>(c) > v;
+        below = in_range && static_cast<U>(c) < v;
+      }
+      else if constexpr(std::numeric_limits<U>::digits > std::numeric_limits<T>::digits) {
+        above = static_cast<U>(c) > v;
+        below = static_cast<U>(c) < v;
+      }
+      lower_ = above ? detail::next_down(c) : c;
+      upper_ = below ? detail::next_up(c) : c;
+    }
+
+    [[nodiscard]] static constexpr interval whole() noexcept
+    {
+      return interval(-std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity());
+    }
+
+    [[nodiscard]] constexpr T lower() const noexcept { return lower_; }
+    [[nodiscard]] constexpr T upper() const noexcept { return upper_; }
+    [[nodiscard]] constexpr T midpoint() const noexcept { return lower_ / 2 + upper_ / 2; }
+    [[nodiscard]] constexpr T width() const noexcept { return detail::add_up(upper_, -lower_); }
+    [[nodiscard]] constexpr bool contains(T v) const noexcept { return lower_ <= v && v <= upper_; }
+
+    // The midpoint
+    template<typename U>
+        requires std::is_arithmetic_v<U>
+    constexpr explicit operator U() const noexcept
+    {
+      return static_cast<U>(midpoint());
+    }
+
+    [[nodiscard]] constexpr interval operator+() const noexcept { return *this; }
+    [[nodiscard]] constexpr interval operator-() const noexcept { return interval(-upper_, -lower_); }
+
+    constexpr interval& operator+=(const interval& rhs) noexcept
+    {
+      lower_ = detail::add_down(lower_, rhs.lower_);
+      upper_ = detail::add_up(upper_, rhs.upper_);
+      return *this;
+    }
+
+    constexpr interval& operator-=(const interval& rhs) noexcept { return *this += -rhs; }
+
+    // The extremes of a product (a quotient) are at the corners. For a fixed endpoint of `*this` the sign
+    // of that endpoint selects the endpoint of `rhs`, so each bound needs two operations and no branch.
+    constexpr interval& operator*=(const interval& rhs) noexcept
+    {
+      const T l = std::min(detail::mul_down(lower_, detail::select(lower_ >= 0, rhs.lower_, rhs.upper_)),
+                           detail::mul_down(upper_, detail::select(upper_ >= 0, rhs.lower_, rhs.upper_)));
+      const T u = std::max(detail::mul_up(lower_, detail::select(lower_ >= 0, rhs.upper_, rhs.lower_)),
+                           detail::mul_up(upper_, detail::select(upper_ >= 0, rhs.upper_, rhs.lower_)));
+      lower_ = l;
+      upper_ = u;
+      return *this;
+    }
+
+    constexpr interval& operator/=(const interval& rhs) noexcept
+    {
+      if(rhs.lower_ <= 0 && rhs.upper_ >= 0) return *this = whole();
+      const T l = std::min(detail::div_down(lower_, detail::select(lower_ >= 0, rhs.upper_, rhs.lower_)),
+                           detail::div_down(upper_, detail::select(upper_ >= 0, rhs.upper_, rhs.lower_)));
+      const T u = std::max(detail::div_up(lower_, detail::select(lower_ >= 0, rhs.lower_, rhs.upper_)),
+                           detail::div_up(upper_, detail::select(upper_ >= 0, rhs.lower_, rhs.upper_)));
+      lower_ = l;
+      upper_ = u;
+      return *this;
+    }
+
+    [[nodiscard]] friend constexpr interval operator+(interval lhs, const interval& rhs) noexcept { return lhs += rhs; }
+    [[nodiscard]] friend constexpr interval operator-(interval lhs, const interval& rhs) noexcept { return lhs -= rhs; }
+    [[nodiscard]] friend constexpr interval operator*(interval lhs, const interval& rhs) noexcept { return lhs *= rhs; }
+    [[nodiscard]] friend constexpr interval operator/(interval lhs, const interval& rhs) noexcept { return lhs /= rhs; }
+
+    [[nodiscard]] friend constexpr bool operator==(const interval& lhs, const interval& rhs) noexcept
+    {
+      return lhs.lower_ == rhs.lower_ && lhs.upper_ == rhs.upper_;
+    }
+
+    [[nodiscard]] friend constexpr std::partial_ordering operator<=>(const interval& lhs, const interval& rhs) noexcept
+    {
+      if(lhs.upper_ < rhs.lower_) return std::partial_ordering::less;
+      if(lhs.lower_ > rhs.upper_) return std::partial_ordering::greater;
+      if(lhs == rhs) return std::partial_ordering::equivalent;
+      return std::partial_ordering::unordered;
+    }
+
+    template<class CharT, class Traits>
+    friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const interval& v)
+    {
+      return os << '[' << v.lower_ << ", " << v.upper_ << ']';
+    }
+  };
+
+  template<typename T>
+  inline constexpr bool treat_as_floating_point<interval<T>> = true;
+
+  template<typename T>
+  struct quantity_values<interval<T>> {
+    static constexpr interval<T> zero() noexcept { return interval<T>(0); }
+    static constexpr interval<T> one() noexcept { return interval<T>(1); }
+    static constexpr interval<T> max() noexcept { return interval<T>(std::numeric_limits<T>::max()); }
+    static constexpr interval<T> min() noexcept { return interval<T>(std::numeric_limits<T>::lowest()); }
+  };
+
+}  // namespace units
+
+namespace std {
+
+  template<typename T, typename U>
+      requires is_arithmetic_v<U>
+  struct common_type<units::interval<T>, U> {
+    using type = units::interval<common_type_t<T, U>>;
+  };
+
+  template<typename T, typename U>
+      requires is_arithmetic_v<T>
+  struct common_type<T, units::interval<U>> {
+    using type = units::interval<common_type_t<T, U>>;
+  };
+
+  template<typename T, typename U>
+  struct common_type<units::interval<T>, units::interval<U>> {
+    using type = units::interval<common_type_t<T, U>>;
+  };
+
+}  // namespace std
@@ -0,0 +1,137 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/dimensions/time.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+namespace units {
+
+  // latency_histogram
+
+  // Lock-free histogram of time quantities with log-linear buckets (as in HdrHistogram). Values are
+  // recorded in nanoseconds. Every power of 2 is split into `2^SubBucketBits` linear sub-buckets, so
+  // the relative error of a reported value is below `2^-SubBucketBits` (~3% for the default) over the
+  // whole `int64_t` range.
+  //
+  // Recording is a bit scan and a relaxed atomic increment. Reads do not block writers, but a reading
+  // that races with recordings is not a consistent snapshot.
+  template<unsigned SubBucketBits = 5>
+      requires (SubBucketBits > 0 && SubBucketBits < 16)
+  class latency_histogram {
+  public:
+    using value_type = quantity<nanosecond, std::int64_t>;
+
+    static constexpr std::size_t sub_bucket_count = std::size_t(1) << SubBucketBits;
+    static constexpr std::size_t bucket_count = (64 - SubBucketBits) * sub_bucket_count;
+
+  private:
+    std::array<std::atomic<std::uint64_t>, bucket_count> counts_{};
+
+    [[nodiscard]] static constexpr std::size_t index_of(std::uint64_t v) noexcept
+    {
+      if(v < sub_bucket_count) {
+        return v;
+      }
+      const unsigned shift = static_cast<unsigned>(std::bit_width(v)) - 1 - SubBucketBits;
+      return ((shift + 1) << SubBucketBits) + ((v >> shift) - sub_bucket_count);
+    }
+
+    // highest value that falls into the bucket
+    [[nodiscard]] static constexpr std::uint64_t upper_bound_of(std::size_t index) noexcept
+    {
+      const std::size_t group = index >> SubBucketBits;
+      const std::uint64_t sub = index & (sub_bucket_count - 1);
+      if(group == 0) {
+        return sub;
+      }
+      const unsigned shift = static_cast<unsigned>(group - 1);
+      return ((sub_bucket_count + sub) << shift) + ((std::uint64_t(1) << shift) - 1);
+    }
+
+  public:
+    // Negative durations are recorded as 0
+    void record(const Time AUTO& t) noexcept
+    {
+      const std::int64_t ns = quantity_cast<value_type>(t).count();
+      counts_[index_of(static_cast<std::uint64_t>(std::max<std::int64_t>(ns, 0)))].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // i.e. `std::chrono::duration`
+    template<QuantityLike T>
+        requires same_dim<typename quantity_like_traits<T>::unit::dimension, time>
+    void record(const T& t) noexcept
+    {
+      record(quantity(t));
+    }
+
+    [[nodiscard]] std::uint64_t count() const noexcept
+    {
+      std::uint64_t total = 0;
+      for(const auto& c : counts_) {
+        total += c.load(std::memory_order_relaxed);
+      }
+      return total;
+    }
+
+    // Value below or at which `p` percent of the recorded values fall, rounded up to the bucket's
+    // upper bound. Returns zero for an empty histogram.
+    [[nodiscard]] value_type percentile(double p) const noexcept
+    {
+      std::array<std::uint64_t, bucket_count> counts;
+      std::uint64_t total = 0;
+      for(std::size_t i = 0; i < bucket_count; ++i) {
+        counts[i] = counts_[i].load(std::memory_order_relaxed);
+        total += counts[i];
+      }
+      if(total == 0) {
+        return value_type::zero();
+      }
+
+      const double clamped = std::clamp(p, 0.0, 100.0);
+      const auto rank = std::max<std::uint64_t>(1, static_cast<std::uint64_t>(std::ceil(clamped / 100 * static_cast<double>(total))));
+      std::uint64_t cumulative = 0;
+      for(std::size_t i = 0; i < bucket_count; ++i) {
+        cumulative += counts[i];
+        if(cumulative >= rank) {
+          return value_type(static_cast<std::int64_t>(upper_bound_of(i)));
+        }
+      }
+      return value_type::max();  // unreachable
+    }
+
+    void reset() noexcept
+    {
+      for(auto& c : counts_) {
+        c.store(0, std::memory_order_relaxed);
+      }
+    }
+  };
+
+}  // namespace units
@@ -0,0 +1,154 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/integration.h>
+#include <units/quantity.h>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+#include <vector>
+
+namespace units {
+
+  // lookup_table
+
+  // Piecewise-linear function `y(x)` given by breakpoints, e.g. the viscosity of a fluid as a function
+  // of its temperature. The breakpoints are stored as raw values in the units of `X` and `Y`, together
+  // with the slope of every segment in the unit of `dimension_divide<Y, X>`, so a lookup is a search
+  // followed by a single multiply-add. Arguments outside the table are clamped to its first and last
+  // breakpoint.
+  //
+  // An argument in any unit of the dimension of `X` is converted once with `quantity_cast` before the
+  // search. The search is a branch-free binary search over the breakpoints padded to a power of 2; the
+  // range overload runs it level by level over a block of arguments, which the compiler vectorizes.
+  template<Quantity X, Quantity Y>
+  class lookup_table {
+  public:
+    using rep = detail::calculus_rep<Y, X>;
+    using argument_type = quantity<typename X::unit, rep>;
+    using value_type = quantity<typename Y::unit, rep>;
+    using slope_type = detail::derivative_quantity<value_type, argument_type>;
+
+  private:
+    std::vector<rep> xs_;
+    std::vector<rep> ys_;
+    std::vector<rep> slopes_;
+    std::vector<rep> keys_;  // starts of the segments padded with the largest value to a power of 2
+
+    [[nodiscard]] rep clamp(rep x) const noexcept { return std::min(std::max(x, xs_.front()), xs_.back()); }
+
+    [[nodiscard]] std::size_t segment(rep x) const noexcept
+    {
+      std::size_t i = 0;
+      for(std::size_t step = keys_.size() / 2; step > 0; step /= 2) i += keys_[i + step] <= x ? step : 0;
+      return i;
+    }
+
+    [[nodiscard]] rep interpolate(std::size_t i, rep x) const noexcept { return ys_[i] + slopes_[i] * (x - xs_[i]); }
+
+  public:
+    // Breakpoints have to be strictly increasing; there have to be at least two of them
+    template<typename Xs, typename Ys>
+      requires detail::QuantityRange<Xs> && detail::QuantityRange<Ys> &&
+               same_dim<typename std::ranges::range_value_t<Xs>::dimension, typename X::dimension> &&
+               same_dim<typename std::ranges::range_value_t<Ys>::dimension, typename Y::dimension>
+    lookup_table(const Xs& xs, const Ys& ys)
+    {
+      const std::size_t n = std::ranges::size(xs);
+      Expects(n >= 2 && std::ranges::size(ys) == n);
+      xs_.reserve(n);
+      ys_.reserve(n);
+      for(const auto& x : xs) xs_.push_back(quantity_cast<argument_type>(x).count());
+      for(const auto& y : ys) ys_.push_back(quantity_cast<value_type>(y).count());
+
+      slopes_.resize(n - 1);
+      for(std::size_t i = 0; i + 1 < n; ++i) {
+        Expects(xs_[i] < xs_[i + 1]);
+        slopes_[i] = (ys_[i + 1] - ys_[i]) / (xs_[i + 1] - xs_[i]);
+      }
+
+      keys_.assign(std::bit_ceil(n - 1), std::numeric_limits<rep>::max());
+      std::copy(xs_.begin(), xs_.end() - 1, keys_.begin());
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return xs_.size(); }
+    [[nodiscard]] argument_type breakpoint(std::size_t i) const { return argument_type(xs_[i]); }
+    [[nodiscard]] value_type value(std::size_t i) const { return value_type(ys_[i]); }
+    [[nodiscard]] slope_type slope(std::size_t i) const { return slope_type(slopes_[i]); }
+
+    template<Quantity Q>
+    [[nodiscard]] value_type operator()(const Q& q) const noexcept
+      requires same_dim<typename Q::dimension, typename X::dimension>
+    {
+      const rep x = clamp(quantity_cast<argument_type>(q).count());
+      return value_type(interpolate(segment(x), x));
+    }
+
+    // `out[i] = (*this)(in[i])` for the first `size(in)` elements of `out`
+    template<typename In, typename Out>
+      requires detail::QuantityRange<In> && std::ranges::contiguous_range<Out> && std::ranges::sized_range<Out> &&
+               same_dim<typename std::ranges::range_value_t<In>::dimension, typename X::dimension> &&
+               std::is_assignable_v<std::ranges::range_reference_t<Out>, value_type>
+    void operator()(const In& in, Out&& out) const noexcept
+    {
+      constexpr std::size_t block = 256;
+      const std::size_t n = std::ranges::size(in);
+      Expects(std::ranges::size(out) >= n);
+      const auto src = std::ranges::data(in);
+      const auto dst = std::ranges::data(out);
+      // the members are read through local pointers, the stores to `out` could otherwise alias them
+      const rep* const keys = keys_.data();
+      const rep* const xs = xs_.data();
+      const rep* const ys = ys_.data();
+      const rep* const slopes = slopes_.data();
+      const std::size_t top = keys_.size() / 2;
+      const rep lo = xs_.front();
+      const rep hi = xs_.back();
+      rep x[block];
+      std::size_t idx[block];
+      for(std::size_t b = 0; b < n; b += block) {
+        const std::size_t len = std::min(block, n - b);
+        for(std::size_t j = 0; j < len; ++j) {
+          const rep v = quantity_cast<argument_type>(src[b + j]).count();
+          x[j] = v < lo ? lo : (v > hi ? hi : v);
+          idx[j] = 0;
+        }
+        for(std::size_t step = top; step > 0; step /= 2)
+          for(std::size_t j = 0; j < len; ++j) idx[j] += keys[idx[j] + step] <= x[j] ? step : 0;
+        for(std::size_t j = 0; j < len; ++j) {
+          const std::size_t i = idx[j];
+          dst[b + j] = value_type(ys[i] + slopes[i] * (x[j] - xs[i]));
+        }
+      }
+    }
+  };
+
+  template<typename Xs, typename Ys>
+    requires detail::QuantityRange<Xs> && detail::QuantityRange<Ys>
+  lookup_table(const Xs&, const Ys&) -> lookup_table<std::ranges::range_value_t<Xs>, std::ranges::range_value_t<Ys>>;
+
+}  // namespace units
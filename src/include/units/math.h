@@ -24,30 +24,219 @@
 
 #include <units/quantity.h>
 #include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
 
 namespace units {
 
-  template<std::size_t N, typename U, typename Rep>
-    requires N == 0
-  inline Rep AUTO pow(const quantity<U, Rep>&) noexcept
+  namespace detail {
+
+    // v^N by squaring, unrolled at compile time
+    template<std::intmax_t N, typename Rep>
+    [[nodiscard]] constexpr Rep int_pow(const Rep& v)
+    {
+      if constexpr(N == 0) {
+        return Rep(1);
+      }
+      else if constexpr(N == 1) {
+        return v;
+      }
+      else {
+        const Rep half = int_pow<N / 2>(v);
+        if constexpr(N % 2 == 0)
+          return half * half;
+        else
+          return half * half * v;
+      }
+    }
+
+    // v^(Num/Den) for an already reduced fraction. A representation type that carries more than a value
+    // (i.e. an uncertainty) can provide its own `pow<Num, Den>(v)` found with ADL.
+    template<std::intmax_t Num, std::intmax_t Den, typename Rep>
+    [[nodiscard]] constexpr Rep pow_value(const Rep& v)
+    {
+      if constexpr(requires { { pow<Num, Den>(v) } -> std::same_as<Rep>; }) {
+        return pow<Num, Den>(v);
+      }
+      else if constexpr(Num < 0) {
+        return Rep(1) / pow_value<-Num, Den>(v);
+      }
+      else if constexpr(Den == 1) {
+        return int_pow<Num>(v);
+      }
+      else {
+        // unqualified calls so that class representation types are found with ADL
+        using std::cbrt;
+        using std::pow;
+        using std::sqrt;
+        if constexpr(Den == 2)
+          return static_cast<Rep>(sqrt(int_pow<Num>(v)));
+        else if constexpr(Den == 3)
+          return static_cast<Rep>(cbrt(int_pow<Num>(v)));
+        else
+          return static_cast<Rep>(pow(v, static_cast<double>(Num) / static_cast<double>(Den)));
+      }
+    }
+
+    // R^(Num/Den); exact, so it is ill-formed if R has no exact Den-th root
+    template<typename R, std::intmax_t Num, std::intmax_t Den>
+    struct ratio_rational_pow {
+      using type = ratio_pow<ratio_root<R, Den>, static_cast<std::size_t>(Num)>;
+    };
+
+    template<typename R, std::intmax_t Num, std::intmax_t Den>
+      requires (Num < 0)
+    struct ratio_rational_pow<R, Num, Den> {
+      using type = ratio_pow<ratio_root<ratio<R::den, R::num>, Den>, static_cast<std::size_t>(-Num)>;
+    };
+
+  }  // namespace detail
+
+  // Raises a quantity to the rational power `Num/Den`. The dimension exponents are multiplied with
+  // `exp_multiply` and the unit ratio is raised exactly with `ratio_root`/`ratio_pow`. Integral
+  // powers are computed by squaring, so they are exact and `constexpr` for any representation type.
+  // Negative powers of integral representations would truncate, so they are not allowed.
+  template<std::intmax_t Num, std::intmax_t Den = 1, typename U, typename Rep>
+  [[nodiscard]] constexpr Rep pow(const quantity<U, Rep>&) noexcept
+    requires (Den > 0) && (Num == 0)
   {
     return 1;
   }
 
-  template<std::size_t N, typename U, typename Rep>
-  inline Quantity AUTO pow(const quantity<U, Rep>& q) noexcept
+  template<std::intmax_t Num, std::intmax_t Den = 1, typename U, typename Rep>
+  [[nodiscard]] constexpr Quantity AUTO pow(const quantity<U, Rep>& q) noexcept
+    requires (Den > 0) && (Num != 0) && (Num > 0 || treat_as_floating_point<Rep>)
+  {
+    constexpr std::intmax_t gcd = std::gcd(Num, Den);
+    constexpr std::intmax_t num = Num / gcd;
+    constexpr std::intmax_t den = Den / gcd;
+    using dim = dimension_pow<typename U::dimension, num, den>;
+    using r = detail::ratio_rational_pow<typename U::ratio, num, den>::type;
+    return quantity<downcast<unit<dim, r>>, Rep>(detail::pow_value<num, den>(q.count()));
+  }
+
+  template<typename U, typename Rep>
+  [[nodiscard]] constexpr Quantity AUTO sqrt(const quantity<U, Rep>& q) noexcept
+  {
+    return pow<1, 2>(q);
+  }
+
+  template<typename U, typename Rep>
+  [[nodiscard]] constexpr Quantity AUTO cbrt(const quantity<U, Rep>& q) noexcept
   {
-    using dim = dimension_pow<typename U::dimension, N>;
-    using r = ratio_pow<typename U::ratio, N>;
-    return quantity<downcast<unit<dim, r>>, Rep>(static_cast<Rep>(std::pow(q.count(), N)));
+    return pow<1, 3>(q);
   }
 
   template<typename U, typename Rep>
-  inline Quantity AUTO sqrt(const quantity<U, Rep>& q) noexcept
+  [[nodiscard]] constexpr quantity<U, Rep> abs(const quantity<U, Rep>& q) noexcept
+  {
+    return q.count() < 0 ? -q : q;
+  }
+
+  // fma
+
+  namespace detail {
+
+    // `v * R` for a compile-time ratio, a no-op for `R == 1`
+    template<typename R, typename Rep>
+    [[nodiscard]] constexpr Rep scale(const Rep& v)
+    {
+      if constexpr(R::num == 1 && R::den == 1)
+        return v;
+      else if constexpr(treat_as_floating_point<Rep>)
+        return v * (static_cast<Rep>(R::num) / static_cast<Rep>(R::den));
+      else
+        return v * static_cast<Rep>(R::num) / static_cast<Rep>(R::den);
+    }
+
+  }  // namespace detail
+
+  // `a * b + c` with a single rounding for floating-point representations (maps to the hardware FMA
+  // instruction when available). The product and `c` are expressed in their common unit; each of them
+  // is scaled at most once with a compile-time ratio.
+  template<typename U1, typename Rep1, typename U2, typename Rep2, typename U3, typename Rep3>
+  [[nodiscard]] constexpr Quantity AUTO fma(const quantity<U1, Rep1>& a, const quantity<U2, Rep2>& b,
+                                            const quantity<U3, Rep3>& c) noexcept
+    requires same_dim<dimension_multiply<typename U1::dimension, typename U2::dimension>, typename U3::dimension>
+  {
+    using product_ratio = ratio_multiply<typename U1::ratio, typename U2::ratio>;
+    using r = common_ratio<product_ratio, typename U3::ratio>;
+    using rep = std::common_type_t<Rep1, Rep2, Rep3>;
+    using ret = quantity<downcast<unit<typename U3::dimension, r>>, rep>;
+
+    const rep x = detail::scale<ratio_divide<product_ratio, r>>(static_cast<rep>(a.count()));
+    const rep y = static_cast<rep>(b.count());
+    const rep z = detail::scale<ratio_divide<typename U3::ratio, r>>(static_cast<rep>(c.count()));
+    if constexpr(std::is_floating_point_v<rep>) {
+      return ret(std::fma(x, y, z));
+    }
+    else {
+      return ret(x * y + z);
+    }
+  }
+
+  // hypot
+
+  // Arguments are converted to their common unit once. The result has a floating-point representation.
+  template<typename U1, typename Rep1, typename U2, typename Rep2>
+  [[nodiscard]] Quantity AUTO hypot(const quantity<U1, Rep1>& x, const quantity<U2, Rep2>& y) noexcept
+    requires same_dim<typename U1::dimension, typename U2::dimension>
+  {
+    using cq = common_quantity<quantity<U1, Rep1>, quantity<U2, Rep2>>;
+    using std::hypot;
+    const auto r = hypot(cq(x).count(), cq(y).count());
+    return quantity<typename cq::unit, std::remove_const_t<decltype(r)>>(r);
+  }
+
+  template<typename U1, typename Rep1, typename U2, typename Rep2, typename U3, typename Rep3>
+  [[nodiscard]] Quantity AUTO hypot(const quantity<U1, Rep1>& x, const quantity<U2, Rep2>& y,
+                                    const quantity<U3, Rep3>& z) noexcept
+    requires same_dim<typename U1::dimension, typename U2::dimension> &&
+             same_dim<typename U1::dimension, typename U3::dimension>
+  {
+    using cq = common_quantity<common_quantity<quantity<U1, Rep1>, quantity<U2, Rep2>>, quantity<U3, Rep3>>;
+    using std::hypot;
+    const auto r = hypot(cq(x).count(), cq(y).count(), cq(z).count());
+    return quantity<typename cq::unit, std::remove_const_t<decltype(r)>>(r);
+  }
+
+  // min, max, clamp
+
+  // Return the common quantity of the arguments
+  template<typename U1, typename Rep1, typename U2, typename Rep2>
+  [[nodiscard]] constexpr Quantity AUTO min(const quantity<U1, Rep1>& a, const quantity<U2, Rep2>& b) noexcept
+    requires same_dim<typename U1::dimension, typename U2::dimension>
+  {
+    using cq = common_quantity<quantity<U1, Rep1>, quantity<U2, Rep2>>;
+    const cq ca(a);
+    const cq cb(b);
+    return cb.count() < ca.count() ? cb : ca;
+  }
+
+  template<typename U1, typename Rep1, typename U2, typename Rep2>
+  [[nodiscard]] constexpr Quantity AUTO max(const quantity<U1, Rep1>& a, const quantity<U2, Rep2>& b) noexcept
+    requires same_dim<typename U1::dimension, typename U2::dimension>
+  {
+    using cq = common_quantity<quantity<U1, Rep1>, quantity<U2, Rep2>>;
+    const cq ca(a);
+    const cq cb(b);
+    return ca.count() < cb.count() ? cb : ca;
+  }
+
+  template<typename U, typename Rep, typename U1, typename Rep1, typename U2, typename Rep2>
+  [[nodiscard]] constexpr Quantity AUTO clamp(const quantity<U, Rep>& v, const quantity<U1, Rep1>& lo,
+                                              const quantity<U2, Rep2>& hi) noexcept
+    requires same_dim<typename U::dimension, typename U1::dimension> &&
+             same_dim<typename U::dimension, typename U2::dimension>
   {
-    using dim = dimension_sqrt<typename U::dimension>;
-    using r = ratio_sqrt<typename U::ratio>;
-    return quantity<downcast<unit<dim, r>>, Rep>(static_cast<Rep>(std::sqrt(q.count())));
+    using cq = common_quantity<common_quantity<quantity<U, Rep>, quantity<U1, Rep1>>, quantity<U2, Rep2>>;
+    const cq cv(v);
+    const cq clo(lo);
+    const cq chi(hi);
+    Expects(!(chi.count() < clo.count()));
+    return cv.count() < clo.count() ? clo : chi.count() < cv.count() ? chi : cv;
   }
 
 }  // namespace units
@@ -0,0 +1,266 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/bits/unit_list.h>
+#include <units/dimensions/dimensionless.h>
+#include <units/quantity.h>
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace units {
+
+  namespace detail {
+
+    template<Unit U1, Unit U2>
+    using unit_multiply =
+        downcast<unit<dimension_multiply<typename U1::dimension, typename U2::dimension>,
+                      ratio_multiply<typename U1::ratio, typename U2::ratio>>>;
+
+    template<typename List, std::size_t I>
+    struct unit_list_at;
+
+    template<Unit... Us, std::size_t I>
+    struct unit_list_at<unit_list<Us...>, I> : std::tuple_element<I, std::tuple<Us...>> {};
+
+    template<typename List, Unit U>
+    struct unit_list_multiply;
+
+    template<Unit... Us, Unit U>
+    struct unit_list_multiply<unit_list<Us...>, U> : std::type_identity<unit_list<unit_multiply<Us, U>...>> {};
+
+    // Blocked row-major C += A * B with compile-time sizes. The innermost loop runs along a row of B
+    // and C, so it vectorizes; the blocks keep a panel of B in cache while the rows of A stream by.
+    inline constexpr std::size_t gemm_block = 64;
+
+    template<std::size_t M, std::size_t K, std::size_t N, typename Rep>
+    constexpr void gemm(const Rep* a, const Rep* b, Rep* c) noexcept
+    {
+      for(std::size_t kk = 0; kk < K; kk += gemm_block) {
+        const std::size_t k_end = std::min(kk + gemm_block, K);
+        for(std::size_t jj = 0; jj < N; jj += gemm_block) {
+          const std::size_t j_end = std::min(jj + gemm_block, N);
+          for(std::size_t i = 0; i < M; ++i) {
+            for(std::size_t k = kk; k < k_end; ++k) {
+              const Rep aik = a[i * K + k];
+              for(std::size_t j = jj; j < j_end; ++j) c[i * N + j] += aik * b[k * N + j];
+            }
+          }
+        }
+      }
+    }
+
+  }  // namespace detail
+
+  // The unit with the inverted dimension and ratio, i.e. `inverse_unit<second>` is `hertz`
+  template<Unit U>
+  using inverse_unit = downcast<unit<dim_invert<typename U::dimension>, ratio<U::ratio::den, U::ratio::num>>>;
+
+  // matrix
+
+  // Dense matrix whose element (i, j) has the unit `Rows[i] * Cols[j]`. This describes the matrices of
+  // linear systems with mixed units:
+  // - a covariance of a state (x0, x1, ...) is `matrix<unit_list<X0, X1, ...>, unit_list<X0, X1, ...>>`
+  // - a state transition is `matrix<unit_list<X0, X1, ...>, unit_list<inverse_unit<X0>, ...>>`
+  // - a column vector is `matrix<unit_list<X0, X1, ...>, unit_list<one>>`
+  //
+  // Elements are stored as a row-major array of `Rep` and are accessed with compile-time indices.
+  // The multiplication checks at compile time that the inner dimensions agree and runs a blocked
+  // kernel on the raw values.
+  template<typename Rows, typename Cols, Scalar Rep = double>
+  class matrix;
+
+  template<Unit... Rs, Unit... Cs, Scalar Rep>
+  class matrix<unit_list<Rs...>, unit_list<Cs...>, Rep> {
+  public:
+    using row_units = unit_list<Rs...>;
+    using col_units = unit_list<Cs...>;
+    using rep = Rep;
+
+    static constexpr std::size_t rows = sizeof...(Rs);
+    static constexpr std::size_t cols = sizeof...(Cs);
+
+    template<std::size_t I, std::size_t J>
+    using element_type = quantity<detail::unit_multiply<typename detail::unit_list_at<row_units, I>::type,
+                                                        typename detail::unit_list_at<col_units, J>::type>,
+                                  Rep>;
+
+  private:
+    alignas(64) Rep data_[rows * cols] = {};
+
+    template<typename... Qs, std::size_t... Is>
+    static constexpr bool elements_convertible(std::index_sequence<Is...>)
+    {
+      return (std::convertible_to<Qs, element_type<Is / cols, Is % cols>> && ...);
+    }
+
+    template<typename... Qs, std::size_t... Is>
+    constexpr matrix(std::index_sequence<Is...>, const Qs&... qs):
+        data_{element_type<Is / cols, Is % cols>(qs).count()...}
+    {
+    }
+
+  public:
+    matrix() = default;
+
+    // Elements in row-major order
+    template<Quantity... Qs>
+      requires (sizeof...(Qs) == rows * cols) &&
+               (elements_convertible<Qs...>(std::make_index_sequence<rows * cols>()))
+    constexpr explicit matrix(const Qs&... qs): matrix(std::make_index_sequence<rows * cols>(), qs...)
+    {
+    }
+
+    // Ones on the diagonal, which needs dimensionless diagonal elements
+    [[nodiscard]] static constexpr matrix identity() noexcept
+      requires (rows == cols) && ([]<std::size_t... Is>(std::index_sequence<Is...>) {
+                 return (std::same_as<typename element_type<Is, Is>::unit, one> && ...);
+               }(std::make_index_sequence<rows>()))
+    {
+      matrix m;
+      for(std::size_t i = 0; i < rows; ++i) m.data_[i * cols + i] = 1;
+      return m;
+    }
+
+    template<std::size_t I, std::size_t J>
+    [[nodiscard]] constexpr element_type<I, J> get() const noexcept
+      requires (I < rows) && (J < cols)
+    {
+      return element_type<I, J>(data_[I * cols + J]);
+    }
+
+    template<std::size_t I, std::size_t J, Quantity Q>
+      requires (I < rows) && (J < cols) && std::convertible_to<Q, element_type<I, J>>
+    constexpr void set(const Q& q)
+    {
+      data_[I * cols + J] = element_type<I, J>(q).count();
+    }
+
+    [[nodiscard]] constexpr Rep* data() noexcept { return data_; }
+    [[nodiscard]] constexpr const Rep* data() const noexcept { return data_; }
+
+    constexpr matrix& operator+=(const matrix& m)
+    {
+      for(std::size_t i = 0; i < rows * cols; ++i) data_[i] += m.data_[i];
+      return *this;
+    }
+
+    constexpr matrix& operator-=(const matrix& m)
+    {
+      for(std::size_t i = 0; i < rows * cols; ++i) data_[i] -= m.data_[i];
+      return *this;
+    }
+
+    constexpr matrix& operator*=(const Rep& s)
+    {
+      for(std::size_t i = 0; i < rows * cols; ++i) data_[i] *= s;
+      return *this;
+    }
+
+    [[nodiscard]] friend constexpr matrix operator+(matrix lhs, const matrix& rhs) { return lhs += rhs; }
+    [[nodiscard]] friend constexpr matrix operator-(matrix lhs, const matrix& rhs) { return lhs -= rhs; }
+    [[nodiscard]] friend constexpr matrix operator*(matrix m, const Rep& s) { return m *= s; }
+    [[nodiscard]] friend constexpr matrix operator*(const Rep& s, matrix m) { return m *= s; }
+
+    [[nodiscard]] friend constexpr bool operator==(const matrix& lhs, const matrix& rhs)
+    {
+      return std::equal(lhs.data_, lhs.data_ + rows * cols, rhs.data_);
+    }
+  };
+
+  // transpose
+
+  template<Unit... Rs, Unit... Cs, Scalar Rep>
+  [[nodiscard]] constexpr matrix<unit_list<Cs...>, unit_list<Rs...>, Rep> transpose(
+      const matrix<unit_list<Rs...>, unit_list<Cs...>, Rep>& m)
+  {
+    constexpr std::size_t rows = sizeof...(Rs);
+    constexpr std::size_t cols = sizeof...(Cs);
+    matrix<unit_list<Cs...>, unit_list<Rs...>, Rep> ret;
+    for(std::size_t i = 0; i < rows; ++i)
+      for(std::size_t j = 0; j < cols; ++j) ret.data()[j * rows + i] = m.data()[i * cols + j];
+    return ret;
+  }
+
+  // multiplication
+
+  namespace detail {
+
+    // In `A * B` the term `a(i, k) * b(k, j)` has the unit `RowsA[i] * ColsB[j] * (ColsA[k] * RowsB[k])`,
+    // so the products `ColsA[k] * RowsB[k]` have to have the same dimension for every k. The first of
+    // them is the inner unit of the result; rows of B whose inner unit has a different ratio are
+    // rescaled before the kernel runs.
+    template<typename ColsA, typename RowsB>
+    struct matrix_inner {
+      static constexpr bool consistent = false;
+    };
+
+    template<Unit... CAs, Unit... RBs>
+      requires (sizeof...(CAs) == sizeof...(RBs))
+    struct matrix_inner<unit_list<CAs...>, unit_list<RBs...>> {
+      using first = unit_multiply<typename unit_list_at<unit_list<CAs...>, 0>::type,
+                                  typename unit_list_at<unit_list<RBs...>, 0>::type>;
+      static constexpr bool consistent =
+          (same_dim<typename unit_multiply<CAs, RBs>::dimension, typename first::dimension> && ...);
+      static constexpr bool needs_scaling =
+          !(std::same_as<typename unit_multiply<CAs, RBs>::ratio, typename first::ratio> && ...);
+
+      template<typename Rep>
+      static constexpr std::array<Rep, sizeof...(CAs)> scales = {
+          (static_cast<Rep>(ratio_divide<typename unit_multiply<CAs, RBs>::ratio, typename first::ratio>::num) /
+           static_cast<Rep>(ratio_divide<typename unit_multiply<CAs, RBs>::ratio, typename first::ratio>::den))...};
+    };
+
+  }  // namespace detail
+
+  template<typename RowsA, typename ColsA, typename RowsB, typename ColsB, Scalar Rep>
+  [[nodiscard]] constexpr auto operator*(const matrix<RowsA, ColsA, Rep>& a, const matrix<RowsB, ColsB, Rep>& b)
+    requires detail::matrix_inner<ColsA, RowsB>::consistent &&
+             (!detail::matrix_inner<ColsA, RowsB>::needs_scaling || treat_as_floating_point<Rep>)
+  {
+    using inner = detail::matrix_inner<ColsA, RowsB>;
+    using ret_type =
+        matrix<typename detail::unit_list_multiply<RowsA, typename inner::first>::type, ColsB, Rep>;
+    constexpr std::size_t m = matrix<RowsA, ColsA, Rep>::rows;
+    constexpr std::size_t k = matrix<RowsA, ColsA, Rep>::cols;
+    constexpr std::size_t n = matrix<RowsB, ColsB, Rep>::cols;
+
+    ret_type ret;
+    if constexpr(inner::needs_scaling) {
+      matrix<RowsB, ColsB, Rep> scaled = b;
+      for(std::size_t r = 0; r < k; ++r)
+        for(std::size_t c = 0; c < n; ++c) scaled.data()[r * n + c] *= inner::template scales<Rep>[r];
+      detail::gemm<m, k, n>(a.data(), scaled.data(), ret.data());
+    }
+    else {
+      detail::gemm<m, k, n>(a.data(), b.data(), ret.data());
+    }
+    return ret;
+  }
+
+}  // namespace units
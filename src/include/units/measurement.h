@@ -0,0 +1,248 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/math.h>
+#include <units/quantity.h>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace units {
+
+  // measurement
+
+  // Representation type of a value with its standard uncertainty. Operations propagate the uncertainty
+  // to first order assuming that the operands are uncorrelated, e.g. `(a ± ua) * (b ± ub)` has the
+  // uncertainty `sqrt((b * ua)^2 + (a * ub)^2)`. Plain numbers are exact, so a unit conversion scales
+  // the value and the uncertainty by the same ratio.
+  //
+  // `pow()` and `sqrt()` from `math.h` use the derivative of the power instead of repeated
+  // multiplication, which would treat the factors as independent.
+  template<std::floating_point T>
+  class measurement {
+    T value_ = 0;
+    T uncertainty_ = 0;
+
+    [[nodiscard]] static constexpr T combine(T a, T b) noexcept
+    {
+      using std::sqrt;
+      return sqrt(a * a + b * b);
+    }
+
+  public:
+    using value_type = T;
+
+    measurement() = default;
+
+    constexpr measurement(T value, T uncertainty = 0) noexcept: value_(value), uncertainty_(uncertainty)
+    {
+      Expects(uncertainty >= 0);
+    }
+
+    template<typename U>
+        requires std::is_arithmetic_v<U> && (!std::same_as<U, T>)
+    constexpr explicit measurement(U v) noexcept: value_(static_cast<T>(v)) {}
+
+    [[nodiscard]] constexpr T value() const noexcept { return value_; }
+    [[nodiscard]] constexpr T uncertainty() const noexcept { return uncertainty_; }
+    [[nodiscard]] constexpr T relative_uncertainty() const noexcept { return uncertainty_ / (value_ < 0 ? -value_ : value_); }
+
+    template<typename U>
+        requires std::is_arithmetic_v<U>
+    constexpr explicit operator U() const noexcept
+    {
+      return static_cast<U>(value_);
+    }
+
+    [[nodiscard]] constexpr measurement operator+() const noexcept { return *this; }
+    [[nodiscard]] constexpr measurement operator-() const noexcept { return measurement(-value_, uncertainty_); }
+
+    constexpr measurement& operator+=(const measurement& rhs) noexcept
+    {
+      value_ += rhs.value_;
+      uncertainty_ = combine(uncertainty_, rhs.uncertainty_);
+      return *this;
+    }
+
+    constexpr measurement& operator-=(const measurement& rhs) noexcept
+    {
+      value_ -= rhs.value_;
+      uncertainty_ = combine(uncertainty_, rhs.uncertainty_);
+      return *this;
+    }
+
+    constexpr measurement& operator*=(const measurement& rhs) noexcept
+    {
+      uncertainty_ = combine(rhs.value_ * uncertainty_, value_ * rhs.uncertainty_);
+      value_ *= rhs.value_;
+      return *this;
+    }
+
+    constexpr measurement& operator/=(const measurement& rhs) noexcept
+    {
+      value_ /= rhs.value_;
+      uncertainty_ = combine(uncertainty_ / rhs.value_, value_ * rhs.uncertainty_ / rhs.value_);
+      return *this;
+    }
+
+    [[nodiscard]] friend constexpr measurement operator+(measurement lhs, const measurement& rhs) noexcept { return lhs += rhs; }
+    [[nodiscard]] friend constexpr measurement operator-(measurement lhs, const measurement& rhs) noexcept { return lhs -= rhs; }
+    [[nodiscard]] friend constexpr measurement operator*(measurement lhs, const measurement& rhs) noexcept { return lhs *= rhs; }
+    [[nodiscard]] friend constexpr measurement operator/(measurement lhs, const measurement& rhs) noexcept { return lhs /= rhs; }
+
+    // Ordered by the value and then by the uncertainty
+    [[nodiscard]] friend constexpr bool operator==(const measurement&, const measurement&) noexcept = default;
+    [[nodiscard]] friend constexpr auto operator<=>(const measurement&, const measurement&) noexcept = default;
+
+    template<class CharT, class Traits>
+    friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const measurement& m)
+    {
+      return os << m.value_ << " ± " << m.uncertainty_;
+    }
+  };
+
+  template<typename T>
+  inline constexpr bool treat_as_floating_point<measurement<T>> = true;
+
+  template<typename T>
+  struct quantity_values<measurement<T>> {
+    static constexpr measurement<T> zero() noexcept { return measurement<T>(0); }
+    static constexpr measurement<T> one() noexcept { return measurement<T>(1); }
+    static constexpr measurement<T> max() noexcept { return measurement<T>(std::numeric_limits<T>::max()); }
+    static constexpr measurement<T> min() noexcept { return measurement<T>(std::numeric_limits<T>::lowest()); }
+  };
+
+  // `m^(Num/Den)` with the uncertainty `|Num/Den * m^(Num/Den - 1)| * u`; used by `pow()` and `sqrt()`
+  // of quantities
+  template<std::intmax_t Num, std::intmax_t Den, typename T>
+  [[nodiscard]] constexpr measurement<T> pow(const measurement<T>& m) noexcept
+    requires (Den > 0)
+  {
+    const T v = m.value();
+    const T r = detail::pow_value<Num, Den>(v);
+    if(m.uncertainty() == 0) return measurement<T>(r);
+    const T exponent = static_cast<T>(Num) / static_cast<T>(Den);
+    T derivative;
+    if(v != 0)
+      derivative = exponent * r / v;
+    else
+      derivative = Num == Den ? T(1) : (Num > Den ? T(0) : std::numeric_limits<T>::infinity());
+    return measurement<T>(r, (derivative < 0 ? -derivative : derivative) * m.uncertainty());
+  }
+
+  // measurement_array
+
+  // Quantities with uncertainties in structure-of-arrays layout: the values and the uncertainties are
+  // kept in two separate arrays of `T`. Unit conversions of the whole array scale both arrays with one
+  // compile-time ratio in loops that vectorize.
+  template<Unit U, std::floating_point T = double>
+  class measurement_array {
+    std::vector<T> values_;
+    std::vector<T> uncertainties_;
+
+  public:
+    using unit = U;
+    using value_type = quantity<U, measurement<T>>;
+
+    measurement_array() = default;
+
+    explicit measurement_array(std::size_t n): values_(n), uncertainties_(n) {}
+
+    measurement_array(std::vector<T> values, std::vector<T> uncertainties):
+        values_(std::move(values)), uncertainties_(std::move(uncertainties))
+    {
+      Expects(values_.size() == uncertainties_.size());
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return values_.size(); }
+
+    [[nodiscard]] value_type operator[](std::size_t i) const
+    {
+      return value_type(measurement<T>(values_[i], uncertainties_[i]));
+    }
+
+    void set(std::size_t i, const value_type& q)
+    {
+      values_[i] = q.count().value();
+      uncertainties_[i] = q.count().uncertainty();
+    }
+
+    void push_back(const value_type& q)
+    {
+      values_.push_back(q.count().value());
+      uncertainties_.push_back(q.count().uncertainty());
+    }
+
+    [[nodiscard]] std::span<T> values() noexcept { return values_; }
+    [[nodiscard]] std::span<const T> values() const noexcept { return values_; }
+    [[nodiscard]] std::span<T> uncertainties() noexcept { return uncertainties_; }
+    [[nodiscard]] std::span<const T> uncertainties() const noexcept { return uncertainties_; }
+  };
+
+  template<Unit ToU, Unit U, typename T>
+  [[nodiscard]] measurement_array<ToU, T> quantity_cast(const measurement_array<U, T>& a)
+    requires same_dim<typename ToU::dimension, typename U::dimension>
+  {
+    using r = ratio_divide<typename U::ratio, typename ToU::ratio>;
+    const std::size_t n = a.size();
+    measurement_array<ToU, T> ret(n);
+    const T* const v = a.values().data();
+    const T* const u = a.uncertainties().data();
+    T* const rv = ret.values().data();
+    T* const ru = ret.uncertainties().data();
+    for(std::size_t i = 0; i < n; ++i) rv[i] = detail::scale<r>(v[i]);
+    for(std::size_t i = 0; i < n; ++i) ru[i] = detail::scale<r>(u[i]);
+    return ret;
+  }
+
+}  // namespace units
+
+namespace std {
+
+  template<typename T, typename U>
+      requires is_arithmetic_v<U>
+  struct common_type<units::measurement<T>, U> {
+    using type = units::measurement<common_type_t<T, U>>;
+  };
+
+  template<typename T, typename U>
+      requires is_arithmetic_v<T>
+  struct common_type<T, units::measurement<U>> {
+    using type = units::measurement<common_type_t<T, U>>;
+  };
+
+  template<typename T, typename U>
+  struct common_type<units::measurement<T>, units::measurement<U>> {
+    using type = units::measurement<common_type_t<T, U>>;
+  };
+
+}  // namespace std
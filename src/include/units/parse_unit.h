@@ -0,0 +1,351 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/dimensions/si_units.h>
+#include <units/runtime_unit.h>
+#include <units/symbol_table.h>
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace units {
+
+  namespace detail {
+
+    struct prefix_entry {
+      std::string_view symbol;
+      double factor;
+    };
+
+    template<typename... Ps>
+    inline constexpr std::array<prefix_entry, sizeof...(Ps)> prefix_table = {
+        prefix_entry{std::string_view(Ps::symbol.c_str(), Ps::symbol.size()),
+                     static_cast<double>(Ps::ratio::num) / static_cast<double>(Ps::ratio::den)}...};
+
+    // multi-character prefixes go first so that i.e. "da" is not taken for "d"
+    inline constexpr auto& si_prefix_table =
+        prefix_table<deca, atto, femto, pico, nano, micro, milli, centi, deci, hecto, kilo, mega, giga, tera, peta, exa>;
+
+    [[nodiscard]] constexpr runtime_unit to_runtime_unit(const symbol_table_entry& e) noexcept
+    {
+      return runtime_unit{e.dimension, static_cast<double>(e.num) / static_cast<double>(e.den)};
+    }
+
+    // `symbol` is a prefix applied to another predefined unit (i.e. "kg" or "km"), which cannot take
+    // another prefix
+    [[nodiscard]] constexpr bool is_prefixed_si_unit(std::string_view symbol, const runtime_unit& u) noexcept
+    {
+      using table = symbol_table<si_units>;
+
+      for(const prefix_entry& p : si_prefix_table) {
+        if(symbol.size() > p.symbol.size() && symbol.starts_with(p.symbol)) {
+          if(const symbol_table_entry* e = table::find(symbol.substr(p.symbol.size()))) {
+            const runtime_unit base = to_runtime_unit(*e);
+            const double r = p.factor * base.factor / u.factor;
+            if(base.dimension == u.dimension && r > 1 - 1e-12 && r < 1 + 1e-12)
+              return true;
+          }
+        }
+      }
+      return false;
+    }
+
+    [[nodiscard]] constexpr std::optional<runtime_unit> find_si_unit(std::string_view symbol) noexcept
+    {
+      using table = symbol_table<si_units>;
+
+      if(const symbol_table_entry* e = table::find(symbol))
+        return to_runtime_unit(*e);
+
+      for(const prefix_entry& p : si_prefix_table) {
+        if(symbol.size() > p.symbol.size() && symbol.starts_with(p.symbol)) {
+          const std::string_view rest = symbol.substr(p.symbol.size());
+          if(const symbol_table_entry* e = table::find(rest)) {
+            const runtime_unit base = to_runtime_unit(*e);
+            // prefixes are not combined, so i.e. "mkg" is rejected and milligram is "mg"
+            if(is_prefixed_si_unit(rest, base))
+              return std::nullopt;
+            return runtime_unit{base.dimension, p.factor * base.factor};
+          }
+        }
+      }
+      return std::nullopt;
+    }
+
+    // Recursive descent parser of unit expressions:
+    //
+    //   expression := factor { ('*' | '·' | '⋅' | '/') factor }
+    //   factor     := ( symbol | '1' | '(' expression ')' ) [ exponent ]
+    //   exponent   := '^' ['-'] digits | superscript digits
+    //
+    // Parentheses may be nested at most `max_nesting` levels deep, so the recursion depth is bounded.
+    template<typename Lookup>
+    class unit_expression_parser {
+      std::string_view txt_;
+      Lookup& lookup_;
+      int nesting_ = 0;
+
+      static constexpr int max_nesting = 32;
+
+      static constexpr std::array<std::string_view, 10> superscripts = {"⁰", "¹", "²", "³", "⁴", "⁵", "⁶", "⁷", "⁸", "⁹"};
+      static constexpr std::string_view superscript_minus = "⁻";
+
+      constexpr void skip_spaces() noexcept
+      {
+        while(!txt_.empty() && txt_.front() == ' ')
+          txt_.remove_prefix(1);
+      }
+
+      constexpr bool consume(std::string_view token) noexcept
+      {
+        skip_spaces();
+        if(!txt_.starts_with(token))
+          return false;
+        txt_.remove_prefix(token.size());
+        return true;
+      }
+
+      [[nodiscard]] constexpr bool at_symbol_end() const noexcept
+      {
+        if(txt_.empty())
+          return true;
+        const char ch = txt_.front();
+        if(ch == ' ' || ch == '*' || ch == '/' || ch == '^' || ch == '(' || ch == ')' || (ch >= '0' && ch <= '9'))
+          return true;
+        if(txt_.starts_with("·") || txt_.starts_with("⋅") || txt_.starts_with(superscript_minus))
+          return true;
+        for(const auto& s : superscripts)
+          if(txt_.starts_with(s))
+            return true;
+        return false;
+      }
+
+      constexpr std::optional<int> superscript_digit() noexcept
+      {
+        for(std::size_t i = 0; i != superscripts.size(); ++i)
+          if(txt_.starts_with(superscripts[i])) {
+            txt_.remove_prefix(superscripts[i].size());
+            return static_cast<int>(i);
+          }
+        return std::nullopt;
+      }
+
+      // Larger exponents of a base dimension do not fit in a `dimension_code`
+      static constexpr int max_exponent = dimension_code::max_scaled_exponent / dimension_code::exponent_scale;
+
+      constexpr std::optional<int> exponent() noexcept
+      {
+        int sign = 1;
+        int value = 0;
+        bool digits = false;
+        bool too_big = false;
+        // stops at the first digit that makes the exponent too big, so the value never overflows
+        const auto add_digit = [&](int d) {
+          value = value * 10 + d;
+          digits = true;
+          too_big = value > max_exponent;
+        };
+        if(consume("^")) {
+          skip_spaces();
+          if(consume("-"))
+            sign = -1;
+          while(!too_big && !txt_.empty() && txt_.front() >= '0' && txt_.front() <= '9') {
+            add_digit(txt_.front() - '0');
+            txt_.remove_prefix(1);
+          }
+        }
+        else {
+          if(txt_.starts_with(superscript_minus)) {
+            txt_.remove_prefix(superscript_minus.size());
+            sign = -1;
+          }
+          while(!too_big) {
+            const auto d = superscript_digit();
+            if(!d)
+              break;
+            add_digit(*d);
+          }
+          if(!digits && sign == 1)
+            return 1;
+        }
+        if(!digits || too_big)
+          return std::nullopt;
+        return sign * value;
+      }
+
+      constexpr std::optional<runtime_unit> factor() noexcept
+      {
+        std::optional<runtime_unit> base;
+        if(consume("(")) {
+          if(nesting_ == max_nesting)
+            return std::nullopt;
+          ++nesting_;
+          base = expression();
+          --nesting_;
+          if(!base || !consume(")"))
+            return std::nullopt;
+        }
+        else if(consume("1")) {
+          base = runtime_unit();
+        }
+        else {
+          skip_spaces();
+          std::size_t len = 0;
+          const std::string_view start = txt_;
+          while(!at_symbol_end()) {
+            txt_.remove_prefix(1);
+            ++len;
+          }
+          if(len == 0)
+            return std::nullopt;
+          base = lookup_(start.substr(0, len));
+          if(!base)
+            return std::nullopt;
+        }
+
+        const auto e = exponent();
+        if(!e)
+          return std::nullopt;
+        std::optional<runtime_unit> ret = runtime_unit();
+        for(int i = 0; ret && i < (*e < 0 ? -*e : *e); ++i)
+          ret = multiply(*ret, *base);
+        return ret && *e < 0 ? divide(runtime_unit(), *ret) : ret;
+      }
+
+      // Dimensions with exponents that do not fit in a `dimension_code` are an error
+      [[nodiscard]] static constexpr std::optional<runtime_unit> multiply(const runtime_unit& lhs, const runtime_unit& rhs) noexcept
+      {
+        if(multiplication_overflows(lhs.dimension, rhs.dimension))
+          return std::nullopt;
+        return lhs * rhs;
+      }
+
+      [[nodiscard]] static constexpr std::optional<runtime_unit> divide(const runtime_unit& lhs, const runtime_unit& rhs) noexcept
+      {
+        if(division_overflows(lhs.dimension, rhs.dimension))
+          return std::nullopt;
+        return lhs / rhs;
+      }
+
+      constexpr std::optional<runtime_unit> expression() noexcept
+      {
+        std::optional<runtime_unit> ret = factor();
+        while(ret) {
+          if(consume("*") || consume("·") || consume("⋅")) {
+            const auto rhs = factor();
+            ret = rhs ? multiply(*ret, *rhs) : std::nullopt;
+          }
+          else if(consume("/")) {
+            const auto rhs = factor();
+            ret = rhs ? divide(*ret, *rhs) : std::nullopt;
+          }
+          else
+            break;
+        }
+        return ret;
+      }
+
+    public:
+      constexpr unit_expression_parser(std::string_view txt, Lookup& lookup) noexcept: txt_(txt), lookup_(lookup) {}
+
+      constexpr std::optional<runtime_unit> parse() noexcept
+      {
+        auto ret = expression();
+        skip_spaces();
+        return txt_.empty() ? ret : std::nullopt;
+      }
+    };
+
+  }  // namespace detail
+
+  // parse_unit
+
+  // Parses a unit expression like "kg*m/s^2", "km/h" or "J/(kg·K)" into its runtime dimension and factor.
+  // `lookup` resolves a single unit symbol to `std::optional<runtime_unit>`.
+  template<typename Lookup>
+  [[nodiscard]] constexpr std::optional<runtime_unit> parse_unit(std::string_view expr, Lookup&& lookup)
+  {
+    return detail::unit_expression_parser<std::remove_reference_t<Lookup>>(expr, lookup).parse();
+  }
+
+  // Parses a unit expression using the predefined units with optional SI prefixes.
+  [[nodiscard]] constexpr std::optional<runtime_unit> parse_unit(std::string_view expr) noexcept
+  {
+    return parse_unit(expr, detail::find_si_unit);
+  }
+
+  // Parses both unit expressions and returns a conversion between them.
+  [[nodiscard]] constexpr std::optional<unit_conversion> parse_conversion(std::string_view from, std::string_view to) noexcept
+  {
+    const auto f = parse_unit(from);
+    const auto t = parse_unit(to);
+    if(!f || !t)
+      return std::nullopt;
+    return make_conversion(*f, *t);
+  }
+
+  // unit_conversion_cache
+
+  // Conversions between unit expressions, each pair parsed only on its first use. Failed parses are
+  // cached as well. Lookups of already cached pairs take a shared lock only, so the cache may be used
+  // from many threads. The returned conversion should still be kept by callers that convert many values.
+  class unit_conversion_cache {
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, std::optional<unit_conversion>> cache_;
+
+    [[nodiscard]] static std::string key(std::string_view from, std::string_view to)
+    {
+      std::string ret;
+      ret.reserve(from.size() + 1 + to.size());
+      ret.append(from).append(1, '\0').append(to);
+      return ret;
+    }
+
+  public:
+    [[nodiscard]] std::optional<unit_conversion> get(std::string_view from, std::string_view to)
+    {
+      std::string k = key(from, to);
+      {
+        std::shared_lock lock(mutex_);
+        if(const auto it = cache_.find(k); it != cache_.end())
+          return it->second;
+      }
+      const auto c = parse_conversion(from, to);
+      std::lock_guard lock(mutex_);
+      return cache_.try_emplace(std::move(k), c).first->second;
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+      std::shared_lock lock(mutex_);
+      return cache_.size();
+    }
+  };
+
+}  // namespace units
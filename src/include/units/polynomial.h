@@ -0,0 +1,163 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/math.h>
+#include <units/quantity.h>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <ranges>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace units {
+
+  namespace detail {
+
+    // `a * b + c`, fused when the target has FMA instructions so that the batch loop still vectorizes
+    template<typename Rep>
+    [[nodiscard]] constexpr Rep multiply_add(const Rep& a, const Rep& b, const Rep& c) noexcept
+    {
+#if defined(FP_FAST_FMA) && defined(FP_FAST_FMAF)
+      if constexpr(std::is_floating_point_v<Rep>) {
+        if(!std::is_constant_evaluated()) return std::fma(a, b, c);
+      }
+#endif
+      return a * b + c;
+    }
+
+    // a[0] + x * (a[1] + x * (a[2] + ...)), unrolled at compile time
+    template<std::size_t I, typename Rep, std::size_t N>
+    [[nodiscard]] constexpr Rep horner_eval(const std::array<Rep, N>& a, const Rep& x) noexcept
+    {
+      if constexpr(I == N - 1)
+        return a[I];
+      else
+        return multiply_add(horner_eval<I + 1>(a, x), x, a[I]);
+    }
+
+    // Every coefficient has to be the previous one divided by the input, i.e. `c[k]` has the dimension
+    // `c[0] / x^k`, so that all the terms of the sum have the dimension of `c[0]`
+    template<Quantity... Cs>
+    struct polynomial_dimensions {
+      template<std::size_t K>
+      using dimension_of = std::tuple_element_t<K, std::tuple<Cs...>>::dimension;
+
+      using output = dimension_of<0>;
+      using input = dimension_divide<output, dimension_of<1>>;
+
+      template<std::size_t... Ks>
+      static constexpr bool check(std::index_sequence<Ks...>)
+      {
+        return (same_dim<dimension_divide<dimension_of<Ks>, dimension_of<Ks + 1>>, input> && ...);
+      }
+
+      static constexpr bool consistent = check(std::make_index_sequence<sizeof...(Cs) - 1>());
+    };
+
+  }  // namespace detail
+
+  // polynomial
+
+  // `c[0] + c[1] * x + ... + c[n] * x^n` with coefficients of different dimensions, e.g. a calibration
+  // curve from `volt` to `pascal` has the coefficients `Pa`, `Pa/V`, `Pa/V^2`, ... The coefficient
+  // dimensions are checked when the type is formed, so a wrong unit in any of them does not compile.
+  //
+  // The evaluation converts the coefficients once to raw values in the units of the argument and the
+  // result (`c[0]`), then runs Horner's scheme on the raw values. The range overload evaluates a
+  // whole contiguous buffer with the converted coefficients and vectorizes.
+  template<Quantity... Cs>
+    requires (sizeof...(Cs) >= 2) && detail::polynomial_dimensions<Cs...>::consistent
+  class polynomial {
+    using dimensions = detail::polynomial_dimensions<Cs...>;
+
+    std::tuple<Cs...> coefficients_;
+
+    template<std::size_t K>
+    using coefficient_type = std::tuple_element_t<K, std::tuple<Cs...>>;
+
+    // c[k] expressed in `unit(c[0]) / U^k`
+    template<typename U, typename Rep>
+    [[nodiscard]] constexpr std::array<Rep, sizeof...(Cs)> raw_coefficients() const
+    {
+      return [&]<std::size_t... Ks>(std::index_sequence<Ks...>) {
+        return std::array<Rep, sizeof...(Cs)>{
+            detail::scale<ratio_divide<ratio_multiply<typename coefficient_type<Ks>::unit::ratio, ratio_pow<typename U::ratio, Ks>>,
+                                       typename coefficient_type<0>::unit::ratio>>(
+                static_cast<Rep>(std::get<Ks>(coefficients_).count()))...};
+      }(std::index_sequence_for<Cs...>());
+    }
+
+  public:
+    using input_dimension = dimensions::input;
+    using output_dimension = dimensions::output;
+
+    template<typename Rep>
+    using result_type = quantity<typename coefficient_type<0>::unit, Rep>;
+
+    static constexpr std::size_t degree = sizeof...(Cs) - 1;
+
+    constexpr explicit polynomial(const Cs&... cs): coefficients_(cs...) {}
+
+    template<std::size_t K>
+    [[nodiscard]] constexpr const coefficient_type<K>& coefficient() const noexcept
+      requires (K <= degree)
+    {
+      return std::get<K>(coefficients_);
+    }
+
+    template<typename U, typename Rep>
+    [[nodiscard]] constexpr Quantity AUTO operator()(const quantity<U, Rep>& x) const
+      requires same_dim<typename U::dimension, input_dimension>
+    {
+      using rep = std::common_type_t<Rep, typename Cs::rep...>;
+      const auto a = raw_coefficients<U, rep>();
+      return result_type<rep>(detail::horner_eval<0>(a, static_cast<rep>(x.count())));
+    }
+
+    // `out[i] = p(in[i])` for the first `size(in)` elements of `out`
+    template<typename In, typename Out>
+      requires std::ranges::contiguous_range<In> && std::ranges::sized_range<In> &&
+               std::ranges::contiguous_range<Out> && std::ranges::sized_range<Out> &&
+               Quantity<std::ranges::range_value_t<In>> &&
+               same_dim<typename std::ranges::range_value_t<In>::dimension, input_dimension>
+    void operator()(const In& in, Out&& out) const
+    {
+      using x_type = std::ranges::range_value_t<In>;
+      using rep = std::common_type_t<typename x_type::rep, typename Cs::rep...>;
+      const auto a = raw_coefficients<typename x_type::unit, rep>();
+      const auto n = std::ranges::size(in);
+      Expects(std::ranges::size(out) >= n);
+      const auto src = std::ranges::data(in);
+      const auto dst = std::ranges::data(out);
+      for(std::size_t i = 0; i < n; ++i)
+        dst[i] = result_type<rep>(detail::horner_eval<0>(a, static_cast<rep>(src[i].count())));
+    }
+  };
+
+  template<Quantity... Cs>
+  polynomial(Cs...) -> polynomial<Cs...>;
+
+}  // namespace units
@@ -61,6 +61,28 @@ namespace units {
 
   }  // namespace detail
 
+  // quantity_like_traits
+
+  // Customization point for quantity types of other libraries (i.e. `std::chrono::duration`).
+  // A specialization provides `unit`, `rep`, `static rep count(const T&)` and `static T make(rep)`.
+  template<typename T>
+  struct quantity_like_traits;
+
+  namespace detail {
+
+    template<typename T>
+    concept has_quantity_like_traits = requires { sizeof(quantity_like_traits<T>); };
+
+  }  // namespace detail
+
+  template<typename T>
+  concept QuantityLike = (!Quantity<T>) && detail::has_quantity_like_traits<T> &&
+      requires(const T& t, typename quantity_like_traits<T>::rep r) {
+        typename quantity_like_traits<T>::unit;
+        quantity_like_traits<T>::count(t);
+        quantity_like_traits<T>::make(r);
+      };
+
   // common_quantity
   namespace detail {
 
@@ -90,6 +112,17 @@ namespace units {
   template<typename Rep>  // TODO Conceptify that
   inline constexpr bool treat_as_floating_point = std::is_floating_point_v<Rep>;
 
+  namespace detail {
+
+    // conversion that can be done implicitly as it never truncates
+    template<typename FromU, typename FromRep, typename ToU, typename ToRep>
+    inline constexpr bool is_lossless_conversion =
+        same_dim<typename FromU::dimension, typename ToU::dimension> && std::convertible_to<FromRep, ToRep> &&
+        (treat_as_floating_point<ToRep> ||
+          (std::ratio_divide<typename FromU::ratio, typename ToU::ratio>::den == 1 && !treat_as_floating_point<FromRep>));
+
+  }  // namespace detail
+
   // quantity_cast
 
   namespace detail {
@@ -172,6 +205,20 @@ namespace units {
     return quantity_cast<quantity<U, ToRep>>(q);
   }
 
+  template<Quantity To, QuantityLike Q, typename Traits = quantity_like_traits<Q>>
+  [[nodiscard]] constexpr To quantity_cast(const Q& q)
+      requires same_dim<typename To::dimension, typename Traits::unit::dimension>
+  {
+    return quantity_cast<To>(quantity<typename Traits::unit, typename Traits::rep>(Traits::count(q)));
+  }
+
+  template<QuantityLike To, typename U, typename Rep, typename Traits = quantity_like_traits<To>>
+  [[nodiscard]] constexpr To quantity_cast(const quantity<U, Rep>& q)
+      requires same_dim<typename Traits::unit::dimension, typename U::dimension>
+  {
+    return Traits::make(quantity_cast<quantity<typename Traits::unit, typename Traits::rep>>(q).count());
+  }
+
   // quantity_values
 
   template<Scalar Rep>
@@ -205,15 +252,29 @@ namespace units {
     }
 
     template<Quantity Q2>
-        requires same_dim<dimension, typename Q2::dimension> &&
-                std::convertible_to<typename Q2::rep, rep> &&
-                (treat_as_floating_point<rep> ||
-                  (std::ratio_divide<typename Q2::unit::ratio, typename unit::ratio>::den == 1 &&
-                  !treat_as_floating_point<typename Q2::rep>))
+        requires detail::is_lossless_conversion<typename Q2::unit, typename Q2::rep, unit, rep>
     constexpr quantity(const Q2& q): value_{quantity_cast<quantity>(q).count()}
     {
     }
 
+    // quantity-like types of the same dimension convert implicitly if the conversion is lossless and
+    // explicitly otherwise
+    template<QuantityLike Q2, typename Traits = quantity_like_traits<Q2>>
+        requires same_dim<dimension, typename Traits::unit::dimension>
+    constexpr explicit(!detail::is_lossless_conversion<typename Traits::unit, typename Traits::rep, unit, rep>)
+    quantity(const Q2& q):
+        value_{quantity_cast<quantity>(quantity<typename Traits::unit, typename Traits::rep>(Traits::count(q))).count()}
+    {
+    }
+
+    template<QuantityLike Q2, typename Traits = quantity_like_traits<Q2>>
+        requires same_dim<dimension, typename Traits::unit::dimension>
+    constexpr explicit(!detail::is_lossless_conversion<unit, rep, typename Traits::unit, typename Traits::rep>)
+    operator Q2() const
+    {
+      return Traits::make(quantity_cast<quantity<typename Traits::unit, typename Traits::rep>>(*this).count());
+    }
+
     quantity& operator=(const quantity&) = default;
     quantity& operator=(quantity&&) = default;
 
@@ -309,6 +370,9 @@ namespace units {
     }
   };
 
+  template<QuantityLike Q>
+  quantity(const Q&) -> quantity<typename quantity_like_traits<Q>::unit, typename quantity_like_traits<Q>::rep>;
+
   template<typename U1, typename Rep1, typename U2, typename Rep2>
   [[nodiscard]] constexpr Quantity AUTO operator+(const quantity<U1, Rep1>& lhs, const quantity<U2, Rep2>& rhs)
       requires same_dim<typename U1::dimension, typename U2::dimension>
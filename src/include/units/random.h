@@ -0,0 +1,361 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/transcendental.h>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <ratio>
+#include <span>
+#include <type_traits>
+
+// Random quantities
+//
+// The distributions take their parameters as quantities of any unit of the right dimension, convert
+// them once to the unit of the result and then generate plain numbers that are wrapped in the result
+// type, so a draw costs the same as a draw from the underlying standard distribution.
+//
+// `fill()` generates a whole span at once. With a generator that can produce blocks of 32-bit words
+// (such as `philox4x32` below) the numbers are derived from the raw words with branch-free kernels
+// that the compiler vectorizes, other generators are called once per element through the standard
+// distribution.
+
+namespace units {
+
+  namespace detail {
+
+    inline constexpr std::uint32_t philox_m0 = 0xD2511F53;
+    inline constexpr std::uint32_t philox_m1 = 0xCD9E8D57;
+    inline constexpr std::uint32_t philox_w0 = 0x9E3779B9;
+    inline constexpr std::uint32_t philox_w1 = 0xBB67AE85;
+
+    // Philox-4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3") of the 128-bit
+    // counter {c0, c1, 0, 0} with the key {k0, k1}; the words are stored to `out[0]`, `out[s]`,
+    // `out[2 s]` and `out[3 s]`
+    constexpr void philox4x32_10(std::uint64_t counter, std::uint32_t k0, std::uint32_t k1, std::uint32_t* out,
+                                 std::size_t stride) noexcept
+    {
+      std::uint32_t x0 = static_cast<std::uint32_t>(counter);
+      std::uint32_t x1 = static_cast<std::uint32_t>(counter >> 32);
+      std::uint32_t x2 = 0;
+      std::uint32_t x3 = 0;
+      for(int r = 0; r < 10; ++r) {
+        const std::uint64_t p0 = std::uint64_t(philox_m0) * x0;
+        const std::uint64_t p1 = std::uint64_t(philox_m1) * x2;
+        const auto y0 = static_cast<std::uint32_t>(p1 >> 32) ^ x1 ^ k0;
+        const auto y2 = static_cast<std::uint32_t>(p0 >> 32) ^ x3 ^ k1;
+        x1 = static_cast<std::uint32_t>(p1);
+        x3 = static_cast<std::uint32_t>(p0);
+        x0 = y0;
+        x2 = y2;
+        k0 += philox_w0;
+        k1 += philox_w1;
+      }
+      out[0] = x0;
+      out[stride] = x1;
+      out[2 * stride] = x2;
+      out[3 * stride] = x3;
+    }
+
+    // A generator that produces blocks of 32-bit words
+    template<typename G>
+    concept BulkGenerator = std::uniform_random_bit_generator<G> && std::same_as<typename G::result_type, std::uint32_t> &&
+                            requires(G& g, std::span<std::uint32_t> s) { g.generate(s); };
+
+    // [0, 1) with 52 random bits, made by putting the bits in the mantissa of a number in [1, 2)
+    // instead of converting an integer to floating-point, which is not vectorized without AVX-512
+    [[nodiscard]] constexpr double unit_interval(std::uint32_t hi, std::uint32_t lo) noexcept
+    {
+      const std::uint64_t mantissa = (std::uint64_t(hi) << 20) | (lo >> 12);
+      return std::bit_cast<double>(mantissa | std::bit_cast<std::uint64_t>(1.)) - 1.;
+    }
+
+    // Values are generated in blocks so that the random words fit in the L1 cache
+    inline constexpr std::size_t random_block = 256;
+
+  }  // namespace detail
+
+  // philox4x32
+
+  // Counter-based random number generator Philox-4x32-10. The n-th block of four words is a function
+  // of n and the key only, so blocks are independent of each other: `generate()` computes many blocks
+  // at once in vectorized code and `discard()` takes constant time. Streams of different seeds do not
+  // overlap, which makes a seed per thread (or per simulation) a simple way to parallelize.
+  //
+  // The sequence is the one of `std::philox4x32` from C++26 for seeds below 2^32 and period 2^66.
+  class philox4x32 {
+  public:
+    using result_type = std::uint32_t;
+    static constexpr std::uint64_t default_seed = 20111115u;
+
+  private:
+    std::uint32_t k0_;
+    std::uint32_t k1_;
+    std::uint64_t counter_ = 0;  // of the next block to generate
+    std::array<std::uint32_t, 4> buffer_{};
+    std::size_t index_ = 4;  // of the next word in `buffer_`
+
+    constexpr void refill() noexcept
+    {
+      detail::philox4x32_10(counter_++, k0_, k1_, buffer_.data(), 1);
+      index_ = 0;
+    }
+
+    // Number of words generated so far
+    [[nodiscard]] constexpr std::uint64_t position() const noexcept { return 4 * counter_ - (4 - index_); }
+
+  public:
+    constexpr philox4x32() noexcept: philox4x32(default_seed) {}
+    constexpr explicit philox4x32(std::uint64_t seed) noexcept:
+        k0_(static_cast<std::uint32_t>(seed)), k1_(static_cast<std::uint32_t>(seed >> 32))
+    {
+    }
+
+    constexpr void seed(std::uint64_t value = default_seed) noexcept { *this = philox4x32(value); }
+
+    [[nodiscard]] static constexpr result_type min() noexcept { return 0; }
+    [[nodiscard]] static constexpr result_type max() noexcept { return ~result_type(0); }
+
+    constexpr result_type operator()() noexcept
+    {
+      if(index_ == 4) refill();
+      return buffer_[index_++];
+    }
+
+    // Fills `out` with the next `out.size()` words, the same as as many calls to `operator()`
+    constexpr void generate(std::span<result_type> out) noexcept
+    {
+      const std::size_t n = out.size();
+      std::size_t i = 0;
+      for(; index_ < 4 && i < n; ++i) out[i] = buffer_[index_++];
+
+      // Whole blocks are computed for a range of counters at a time into four separate lanes that are
+      // then interleaved, so that the rounds run on full vectors
+      constexpr std::size_t lanes = detail::random_block;
+      std::array<std::uint32_t, 4 * lanes> words;
+      while(n - i >= 4) {
+        const std::size_t blocks = std::min((n - i) / 4, lanes);
+        for(std::size_t b = 0; b < blocks; ++b)
+          detail::philox4x32_10(counter_ + b, k0_, k1_, words.data() + b, lanes);
+        for(std::size_t b = 0; b < blocks; ++b)
+          for(std::size_t w = 0; w < 4; ++w) out[i + 4 * b + w] = words[w * lanes + b];
+        counter_ += blocks;
+        i += 4 * blocks;
+      }
+
+      if(i < n) {
+        refill();
+        for(; i < n; ++i) out[i] = buffer_[index_++];
+      }
+    }
+
+    constexpr void discard(unsigned long long z) noexcept
+    {
+      const std::uint64_t target = position() + z;
+      counter_ = target / 4;
+      index_ = 4;
+      if(target % 4 != 0) {
+        refill();
+        index_ = target % 4;
+      }
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(const philox4x32& lhs, const philox4x32& rhs) noexcept
+    {
+      return lhs.k0_ == rhs.k0_ && lhs.k1_ == rhs.k1_ && lhs.position() == rhs.position();
+    }
+  };
+
+  // uniform_quantity_distribution
+
+  // Quantities uniformly distributed on [a, b) for floating-point and on [a, b] for integral
+  // representations
+  template<Quantity Q>
+    requires std::is_arithmetic_v<typename Q::rep>
+  class uniform_quantity_distribution {
+  public:
+    using result_type = Q;
+    using unit = Q::unit;
+    using rep = Q::rep;
+    using dimension = Q::dimension;
+
+  private:
+    using std_distribution = std::conditional_t<std::is_integral_v<rep>, std::uniform_int_distribution<rep>,
+                                                std::uniform_real_distribution<rep>>;
+    std_distribution dist_;
+
+    // Largest floating-point result. `a + (b - a) * u` rounds up to `b` for `u` close to 1 when the
+    // spacing of `rep` values around `b` is large compared to `b - a`.
+    [[nodiscard]] rep upper() const { return std::nextafter(dist_.b(), dist_.a()); }
+
+  public:
+    uniform_quantity_distribution(): uniform_quantity_distribution(result_type::zero(), result_type::one()) {}
+
+    template<Quantity Q1, Quantity Q2>
+        requires same_dim<dimension, typename Q1::dimension> && same_dim<dimension, typename Q2::dimension>
+    uniform_quantity_distribution(const Q1& a, const Q2& b):
+        dist_(quantity_cast<result_type>(a).count(), quantity_cast<result_type>(b).count())
+    {
+      Expects(this->a() <= this->b());
+    }
+
+    [[nodiscard]] result_type a() const { return result_type(dist_.a()); }
+    [[nodiscard]] result_type b() const { return result_type(dist_.b()); }
+    [[nodiscard]] result_type min() const { return a(); }
+    [[nodiscard]] result_type max() const { return b(); }
+
+    void reset() { dist_.reset(); }
+
+    template<std::uniform_random_bit_generator G>
+    [[nodiscard]] result_type operator()(G& g)
+    {
+      if constexpr(std::is_floating_point_v<rep>)
+        return result_type(std::min(dist_(g), upper()));
+      else
+        return result_type(dist_(g));
+    }
+
+    template<std::uniform_random_bit_generator G>
+    void fill(std::span<result_type> out, G& g)
+    {
+      if constexpr(std::is_floating_point_v<rep> && detail::BulkGenerator<G>) {
+        constexpr std::size_t block = detail::random_block;
+        const double a = static_cast<double>(dist_.a());
+        const double width = static_cast<double>(dist_.b()) - a;
+        const rep upper = this->upper();
+        std::array<std::uint32_t, 2 * block> w;
+        for(std::size_t start = 0; start < out.size(); start += block) {
+          const std::size_t m = std::min(block, out.size() - start);
+          g.generate(std::span(w.data(), 2 * m));
+          const auto dst = out.data() + start;
+          for(std::size_t i = 0; i < m; ++i)
+            dst[i] = result_type(std::min(static_cast<rep>(a + width * detail::unit_interval(w[i], w[m + i])), upper));
+        }
+      }
+      else {
+        for(auto& q : out) q = (*this)(g);
+      }
+    }
+
+    [[nodiscard]] friend bool operator==(const uniform_quantity_distribution&,
+                                         const uniform_quantity_distribution&) = default;
+  };
+
+  template<Quantity Q1, Quantity Q2>
+  uniform_quantity_distribution(Q1, Q2) -> uniform_quantity_distribution<common_quantity<Q1, Q2>>;
+
+  // normal_quantity_distribution
+
+  template<Quantity Q>
+    requires std::is_floating_point_v<typename Q::rep>
+  class normal_quantity_distribution {
+  public:
+    using result_type = Q;
+    using unit = Q::unit;
+    using rep = Q::rep;
+    using dimension = Q::dimension;
+
+  private:
+    std::normal_distribution<rep> dist_;
+
+  public:
+    normal_quantity_distribution(): normal_quantity_distribution(result_type::zero(), result_type::one()) {}
+
+    template<Quantity Q1, Quantity Q2>
+        requires same_dim<dimension, typename Q1::dimension> && same_dim<dimension, typename Q2::dimension>
+    normal_quantity_distribution(const Q1& mean, const Q2& stddev):
+        dist_(quantity_cast<result_type>(mean).count(), quantity_cast<result_type>(stddev).count())
+    {
+      Expects(dist_.stddev() > 0);
+    }
+
+    [[nodiscard]] result_type mean() const { return result_type(dist_.mean()); }
+    [[nodiscard]] result_type stddev() const { return result_type(dist_.stddev()); }
+    [[nodiscard]] result_type min() const { return result_type(dist_.min()); }
+    [[nodiscard]] result_type max() const { return result_type(dist_.max()); }
+
+    void reset() { dist_.reset(); }
+
+    template<std::uniform_random_bit_generator G>
+    [[nodiscard]] result_type operator()(G& g)
+    {
+      return result_type(dist_(g));
+    }
+
+    // With a bulk generator the values come from the Box-Muller transform of pairs of uniform numbers,
+    // with the logarithm, sine and cosine computed by the kernels of transcendental.h. The values are
+    // distributed the same as the ones of `operator()`, but are a different sequence.
+    template<std::uniform_random_bit_generator G>
+    void fill(std::span<result_type> out, G& g)
+    {
+      if constexpr(detail::BulkGenerator<G>) {
+        constexpr std::size_t block = detail::random_block;
+        constexpr double two_pi = static_cast<double>(2 * detail::pi_ld);
+        const double mean = static_cast<double>(dist_.mean());
+        const double stddev = static_cast<double>(dist_.stddev());
+        std::array<std::uint32_t, 2 * block> w;
+        std::array<double, block> z;
+        std::array<double, block / 2> t;
+        for(std::size_t start = 0; start < out.size(); start += block) {
+          const std::size_t m = std::min(block, out.size() - start);
+          const std::size_t pairs = (m + 1) / 2;
+          g.generate(std::span(w.data(), 4 * pairs));
+          for(std::size_t i = 0; i < pairs; ++i) {
+            // u1 in (0, 1] so that the logarithm is finite
+            const double u1 = 1. - detail::unit_interval(w[i], w[pairs + i]);
+            const double u2 = detail::unit_interval(w[2 * pairs + i], w[3 * pairs + i]);
+            const double theta = two_pi * u2;
+            t[i] = -2. * detail::log_kernel<std::ratio<1>>(u1);
+            z[i] = detail::sincos_kernel<std::ratio<1>, true>(theta);
+            z[pairs + i] = detail::sincos_kernel<std::ratio<1>, false>(theta);
+          }
+          // `std::sqrt` may set `errno`, which keeps the loop calling it from being vectorized unless
+          // `-fno-math-errno` is used, so it is kept out of the loop above
+          for(std::size_t i = 0; i < pairs; ++i) {
+            const double r = std::sqrt(t[i]);
+            z[i] *= r;
+            z[pairs + i] *= r;
+          }
+          const auto dst = out.data() + start;
+          for(std::size_t i = 0; i < m; ++i) dst[i] = result_type(static_cast<rep>(mean + stddev * z[i]));
+        }
+      }
+      else {
+        for(auto& q : out) q = (*this)(g);
+      }
+    }
+
+    [[nodiscard]] friend bool operator==(const normal_quantity_distribution&,
+                                         const normal_quantity_distribution&) = default;
+  };
+
+  template<Quantity Q1, Quantity Q2>
+  normal_quantity_distribution(Q1, Q2) -> normal_quantity_distribution<common_quantity<Q1, Q2>>;
+
+}  // namespace units
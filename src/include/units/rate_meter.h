@@ -0,0 +1,212 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/atomic_quantity.h>
+#include <units/dimensions/time.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <numeric>
+#include <utility>
+
+namespace units {
+
+  namespace detail {
+
+    template<typename T>
+    struct rate_value_traits {
+      using rep = T;
+      [[nodiscard]] static constexpr rep count(const T& v) noexcept { return v; }
+    };
+
+    template<Quantity Q>
+    struct rate_value_traits<Q> {
+      using rep = Q::rep;
+      [[nodiscard]] static constexpr rep count(const Q& q) noexcept { return q.count(); }
+    };
+
+    [[nodiscard]] constexpr double to_seconds(const Time AUTO& t) noexcept
+    {
+      return quantity_cast<quantity<second, double>>(t).count();
+    }
+
+    template<typename Rep, typename Period>
+    [[nodiscard]] constexpr double to_seconds(const std::chrono::duration<Rep, Period>& d) noexcept
+    {
+      return std::chrono::duration<double>(d).count();
+    }
+
+    template<typename Clock, typename Duration>
+    [[nodiscard]] constexpr double to_seconds(const std::chrono::time_point<Clock, Duration>& tp) noexcept
+    {
+      return to_seconds(tp.time_since_epoch());
+    }
+
+    template<typename T>
+    concept Timestamp = requires(const T& t) { detail::to_seconds(t); };
+
+  }  // namespace detail
+
+  // rate_of
+
+  // The type of `T` per unit of time, i.e. `quantity<watt, double>` for `quantity<joule>` or
+  // `quantity<hertz, double>` for a plain count
+  template<typename T>
+      requires Quantity<T> || Scalar<T>
+  using rate_of = decltype(std::declval<T>() / std::declval<quantity<second, double>>());
+
+  // Accumulator of increments of type `T` shared by writers and a reader
+  //
+  // Writers only perform a single relaxed atomic RMW. A ticking meter takes the pending value with an
+  // atomic exchange, so increments are never lost - the ones racing with a tick are counted in the next
+  // interval.
+  template<typename T>
+  class rate_accumulator {
+  protected:
+    using traits = detail::rate_value_traits<T>;
+    std::atomic<typename traits::rep> pending_{};
+
+    typename traits::rep take() noexcept { return pending_.exchange({}, std::memory_order_relaxed); }
+
+  public:
+    void add(const T& v) noexcept { detail::atomic_fetch_add(pending_, traits::count(v), std::memory_order_relaxed); }
+  };
+
+  // rate_meter
+
+  // Average rate since the meter was started (or last restarted)
+  template<typename T>
+      requires Quantity<T> || Scalar<T>
+  class rate_meter : public rate_accumulator<T> {
+  public:
+    using value_type = T;
+    using rate_type = rate_of<T>;
+
+  private:
+    std::atomic<double> start_;  // seconds
+
+  public:
+    template<detail::Timestamp Time>
+    explicit rate_meter(const Time& start) noexcept: start_(detail::to_seconds(start)) {}
+
+    // Average rate between the start and `now`
+    template<detail::Timestamp Time>
+    [[nodiscard]] rate_type rate(const Time& now) const noexcept
+    {
+      const auto total = static_cast<double>(this->pending_.load(std::memory_order_relaxed));
+      return rate_type(total / (detail::to_seconds(now) - start_.load(std::memory_order_relaxed)));
+    }
+
+    template<detail::Timestamp Time>
+    void restart(const Time& start) noexcept
+    {
+      this->take();
+      start_.store(detail::to_seconds(start), std::memory_order_relaxed);
+    }
+  };
+
+  // ewma_rate
+
+  // Exponentially weighted moving average of a rate, updated by calling `tick()` every `interval`
+  //
+  // The decay factor `1 - exp(-interval / time_constant)` is computed once at construction so each
+  // tick is a branch-free `rate += alpha * (instant - rate)`. The rate is published with an atomic store
+  // so readers never block the writers nor the ticking thread. `tick()` must be called from a single
+  // thread.
+  template<typename T>
+      requires Quantity<T> || Scalar<T>
+  class ewma_rate : public rate_accumulator<T> {
+  public:
+    using value_type = T;
+    using rate_type = rate_of<T>;
+
+  private:
+    double inv_interval_;
+    double alpha_;
+    std::atomic<double> rate_ = 0;
+
+  public:
+    ewma_rate(const Time AUTO& interval, const Time AUTO& time_constant) noexcept:
+        inv_interval_(1 / detail::to_seconds(interval)),
+        alpha_(1 - std::exp(-detail::to_seconds(interval) / detail::to_seconds(time_constant)))
+    {
+    }
+
+    void tick() noexcept
+    {
+      const double instant = static_cast<double>(this->take()) * inv_interval_;
+      const double r = rate_.load(std::memory_order_relaxed);
+      rate_.store(r + alpha_ * (instant - r), std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] rate_type rate() const noexcept { return rate_type(rate_.load(std::memory_order_relaxed)); }
+  };
+
+  // windowed_rate
+
+  // Rate over the last `N` intervals, updated by calling `tick()` every `interval`
+  //
+  // The sum over the window is maintained incrementally, so a tick costs O(1) regardless of `N`. For
+  // floating-point representations it is recomputed from the buckets once per window so that rounding
+  // errors do not accumulate over long runs. The rate is published with an atomic store so readers never
+  // block the writers nor the ticking thread. `tick()` must be called from a single thread.
+  template<typename T, std::size_t N>
+      requires (Quantity<T> || Scalar<T>) && (N > 0)
+  class windowed_rate : public rate_accumulator<T> {
+  public:
+    using value_type = T;
+    using rate_type = rate_of<T>;
+
+  private:
+    using rep = detail::rate_value_traits<T>::rep;
+
+    double inv_window_;
+    std::array<rep, N> buckets_{};
+    rep sum_{};
+    std::size_t oldest_ = 0;
+    std::atomic<double> rate_ = 0;
+
+  public:
+    explicit windowed_rate(const Time AUTO& interval) noexcept: inv_window_(1 / (N * detail::to_seconds(interval))) {}
+
+    void tick() noexcept
+    {
+      const rep v = this->take();
+      sum_ += v - buckets_[oldest_];
+      buckets_[oldest_] = v;
+      oldest_ = (oldest_ + 1) % N;
+      if constexpr(treat_as_floating_point<rep>) {
+        if(oldest_ == 0) {
+          sum_ = std::accumulate(buckets_.begin(), buckets_.end(), rep{});
+        }
+      }
+      rate_.store(static_cast<double>(sum_) * inv_window_, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] rate_type rate() const noexcept { return rate_type(rate_.load(std::memory_order_relaxed)); }
+  };
+
+}  // namespace units
@@ -178,6 +178,54 @@ namespace units {
   template<Ratio R>
   using ratio_sqrt = detail::ratio_sqrt_impl<R>::type;
 
+  // ratio_root
+
+  namespace detail {
+
+    // `v^n` or `limit + 1` if the result would exceed `limit`
+    constexpr std::intmax_t bounded_pow(std::intmax_t v, std::intmax_t n, std::intmax_t limit)
+    {
+      std::intmax_t result = 1;
+      for(std::intmax_t i = 0; i < n; ++i) {
+        if(v != 0 && result > limit / v) return limit + 1;
+        result *= v;
+      }
+      return result;
+    }
+
+    // largest `r` such that `r^n <= v`
+    constexpr std::intmax_t root_impl(std::intmax_t v, std::intmax_t n)
+    {
+      std::intmax_t l = 0;
+      std::intmax_t r = v;
+      while(l < r) {
+        const auto mid = l + (r - l + 1) / 2;
+        if(bounded_pow(mid, n, v) <= v)
+          l = mid;
+        else
+          r = mid - 1;
+      }
+      return l;
+    }
+
+    constexpr bool has_exact_root(std::intmax_t v, std::intmax_t n)
+    {
+      const std::intmax_t abs_v = v < 0 ? -v : v;
+      return (v >= 0 || n % 2 == 1) && bounded_pow(root_impl(abs_v, n), n, abs_v) == abs_v;
+    }
+
+    constexpr std::intmax_t exact_root(std::intmax_t v, std::intmax_t n)
+    {
+      return v < 0 ? -root_impl(-v, n) : root_impl(v, n);
+    }
+
+  }
+
+  // Exact N-th root of a ratio. Ill-formed if the numerator or the denominator is not an exact N-th power.
+  template<Ratio R, std::intmax_t N>
+    requires (N > 0) && (detail::has_exact_root(R::num, N)) && (detail::has_exact_root(R::den, N))
+  using ratio_root = ratio<detail::exact_root(R::num, N), detail::exact_root(R::den, N)>;
+
 
   // common_ratio
 
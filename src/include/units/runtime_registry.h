@@ -0,0 +1,235 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/bits/thread_index.h>
+#include <units/runtime_unit.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace units {
+
+  // runtime_registry
+
+  // Registry of units known at runtime. It may be seeded with compile-time units and extended with
+  // user-defined ones (i.e. loaded from configuration files).
+  //
+  // Readers never lock and never wait for a writer. Every modification publishes a new immutable
+  // snapshot of the lookup index with a single atomic store. A reader protects the snapshot it uses with
+  // a hazard pointer in its own cache-line-sized slot, so concurrent readers do not write to shared
+  // cache lines. A lookup retries only when a snapshot is published during it, or probes the next slot
+  // when more than `max_readers` lookups run at the same time. A replaced snapshot is freed as soon as
+  // no slot points to it. Modifications are expected to be rare (startup, configuration reload) and are
+  // serialized with a mutex; `add_all()` publishes a single snapshot for many units.
+  class runtime_registry {
+  public:
+    struct entry {
+      std::string symbol;
+      std::string name;
+      runtime_unit unit;
+    };
+
+    static constexpr std::size_t max_readers = 128;
+
+  private:
+    struct snapshot {
+      std::unordered_map<std::string_view, const entry*> index;
+      std::size_t size = 0;
+    };
+
+    struct alignas(detail::cache_line_size) hazard {
+      std::atomic<const snapshot*> ptr = nullptr;
+    };
+
+    std::mutex mutex_;
+    std::deque<entry> entries_;  // stable addresses
+    std::unique_ptr<snapshot> owner_;  // of `current_`, modified under the mutex
+    std::vector<std::unique_ptr<snapshot>> retired_;  // replaced snapshots still used by readers
+    std::atomic<const snapshot*> current_;
+    mutable std::array<hazard, max_readers> hazards_;
+
+    // The operations on `current_` and the hazard slots are sequentially consistent: a reader publishes
+    // its hazard pointer before it checks `current_` again, and the writer stores `current_` before it
+    // scans the slots.
+    class read_guard {
+      std::atomic<const snapshot*>* slot_ = nullptr;
+      const snapshot* snapshot_ = nullptr;
+
+    public:
+      explicit read_guard(const runtime_registry& r) noexcept
+      {
+        for(std::size_t i = detail::this_thread_index();; ++i) {
+          auto& slot = r.hazards_[i % max_readers].ptr;
+          const snapshot* s = r.current_.load();
+          const snapshot* expected = nullptr;
+          if(!slot.compare_exchange_strong(expected, s)) {
+            continue;  // slot used by another reader
+          }
+          if(r.current_.load() == s) {
+            slot_ = &slot;
+            snapshot_ = s;
+            return;
+          }
+          slot.store(nullptr);  // `s` was replaced and may already be freed
+        }
+      }
+      ~read_guard() { slot_->store(nullptr, std::memory_order_release); }
+      read_guard(const read_guard&) = delete;
+      read_guard& operator=(const read_guard&) = delete;
+
+      [[nodiscard]] const snapshot* operator->() const noexcept { return snapshot_; }
+    };
+
+    [[nodiscard]] bool in_use(const snapshot* s) const noexcept
+    {
+      return std::ranges::any_of(hazards_, [&](const hazard& h) { return h.ptr.load() == s; });
+    }
+
+    [[nodiscard]] bool can_add(const snapshot& s, const entry& e) const
+    {
+      return !e.symbol.empty() && e.symbol != e.name && !s.index.contains(e.symbol) &&
+             (e.name.empty() || !s.index.contains(e.name));
+    }
+
+    void insert(snapshot& s, entry e)
+    {
+      const entry& added = entries_.emplace_back(std::move(e));
+      s.index.emplace(added.symbol, &added);
+      if(!added.name.empty())
+        s.index.emplace(added.name, &added);
+      ++s.size;
+    }
+
+    // Must be called with the mutex locked
+    void publish(std::unique_ptr<snapshot> next)
+    {
+      current_.store(next.get());
+      retired_.push_back(std::exchange(owner_, std::move(next)));
+      std::erase_if(retired_, [&](const std::unique_ptr<snapshot>& old) { return !in_use(old.get()); });
+    }
+
+  public:
+    runtime_registry(): owner_(std::make_unique<snapshot>()), current_(owner_.get()) {}
+
+    template<template<typename...> typename List, Unit... Us>
+    explicit runtime_registry(List<Us...>): runtime_registry()
+    {
+      add_all(std::vector<entry>{entry{std::string(Us::symbol.c_str()), std::string(), runtime_unit_of<Us>}...});
+    }
+
+    runtime_registry(const runtime_registry&) = delete;
+    runtime_registry& operator=(const runtime_registry&) = delete;
+
+    // Adds a new unit. Returns `false` and leaves the registry unchanged if its symbol is empty or equal
+    // to its name, or if its symbol or name is already taken.
+    bool add(std::string symbol, std::string name, const runtime_unit& unit)
+    {
+      entry e{std::move(symbol), std::move(name), unit};
+      std::lock_guard lock(mutex_);
+      if(!can_add(*owner_, e))
+        return false;
+      auto next = std::make_unique<snapshot>(*owner_);
+      insert(*next, std::move(e));
+      publish(std::move(next));
+      return true;
+    }
+
+    // Adds a new unit defined as `factor` times an already registered unit.
+    bool add(std::string symbol, std::string name, double factor, std::string_view unit)
+    {
+      const entry* base = find(unit);
+      if(base == nullptr)
+        return false;
+      return add(std::move(symbol), std::move(name), runtime_unit{base->unit.dimension, factor * base->unit.factor});
+    }
+
+    template<Unit U>
+    bool add(std::string name = {})
+    {
+      return add(std::string(U::symbol.c_str()), std::move(name), runtime_unit_of<U>);
+    }
+
+    // Adds many units at once with a single copy of the index. Units that `add()` would reject
+    // (including the ones clashing with an earlier unit of `entries`) are skipped. Returns the number of
+    // units added.
+    template<std::ranges::input_range R>
+        requires std::convertible_to<std::ranges::range_reference_t<R>, entry>
+    std::size_t add_all(R&& entries)
+    {
+      std::lock_guard lock(mutex_);
+      auto next = std::make_unique<snapshot>(*owner_);
+      std::size_t count = 0;
+      for(auto&& item : entries) {
+        entry e = std::forward<decltype(item)>(item);
+        if(can_add(*next, e)) {
+          insert(*next, std::move(e));
+          ++count;
+        }
+      }
+      if(count != 0)
+        publish(std::move(next));
+      return count;
+    }
+
+    // Finds a unit by its symbol or name.
+    [[nodiscard]] const entry* find(std::string_view symbol_or_name) const noexcept
+    {
+      const read_guard s(*this);
+      const auto& index = s->index;
+      const auto it = index.find(symbol_or_name);
+      return it != index.end() ? it->second : nullptr;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+      const read_guard s(*this);
+      return s->size;
+    }
+
+    // Returns a conversion between two registered units or `std::nullopt` if any of them is not found
+    // or their dimensions differ. The result should be kept by the caller and reused for subsequent
+    // conversions.
+    [[nodiscard]] std::optional<unit_conversion> conversion(std::string_view from, std::string_view to) const noexcept
+    {
+      const read_guard s(*this);
+      const auto& index = s->index;
+      const auto f = index.find(from);
+      const auto t = index.find(to);
+      if(f == index.end() || t == index.end())
+        return std::nullopt;
+      return make_conversion(f->second->unit, t->second->unit);
+    }
+  };
+
+}  // namespace units
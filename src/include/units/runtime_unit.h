@@ -0,0 +1,82 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/dimension_code.h>
+#include <units/unit.h>
+#include <optional>
+
+namespace units {
+
+  // runtime_unit
+
+  // Unit known only at runtime described by its dimension and a factor relative to the coherent unit.
+  struct runtime_unit {
+    dimension_code dimension;
+    double factor = 1;
+
+    [[nodiscard]] friend constexpr runtime_unit operator*(const runtime_unit& lhs, const runtime_unit& rhs) noexcept
+    {
+      return {lhs.dimension * rhs.dimension, lhs.factor * rhs.factor};
+    }
+
+    [[nodiscard]] friend constexpr runtime_unit operator/(const runtime_unit& lhs, const runtime_unit& rhs) noexcept
+    {
+      return {lhs.dimension / rhs.dimension, lhs.factor / rhs.factor};
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(const runtime_unit& lhs, const runtime_unit& rhs) noexcept
+    {
+      return lhs.dimension == rhs.dimension && lhs.factor == rhs.factor;
+    }
+
+    [[nodiscard]] friend constexpr bool operator!=(const runtime_unit& lhs, const runtime_unit& rhs) noexcept
+    {
+      return !(lhs == rhs);
+    }
+  };
+
+  template<Unit U>
+      requires EncodableDimension<typename U::dimension>
+  inline constexpr runtime_unit runtime_unit_of = {
+      dimension_code_of<typename U::dimension>,
+      static_cast<double>(U::ratio::num) / static_cast<double>(U::ratio::den)};
+
+  // unit_conversion
+
+  // Conversion between two runtime units of the same dimension resolved to a single factor,
+  // so that converting a value is a single multiply.
+  struct unit_conversion {
+    double factor = 1;
+
+    [[nodiscard]] constexpr double operator()(double value) const noexcept { return value * factor; }
+  };
+
+  [[nodiscard]] constexpr std::optional<unit_conversion> make_conversion(const runtime_unit& from, const runtime_unit& to) noexcept
+  {
+    if(from.dimension != to.dimension)
+      return std::nullopt;
+    return unit_conversion{from.factor / to.factor};
+  }
+
+}  // namespace units
@@ -0,0 +1,101 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/atomic_quantity.h>
+#include <units/bits/thread_index.h>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+namespace units {
+
+  // sharded_accumulator
+
+  // Sum of quantities updated concurrently from many threads. Each thread adds to its own
+  // cache-line-sized shard, so writers do not share cache lines with each other as long as there are
+  // at least as many shards as threads. Reading the value sums all the shards and is therefore more
+  // expensive than an update - the type is meant for counters that are written often and read rarely.
+  //
+  // `add()` accepts any quantity whose `common_quantity` with `Q` is `Q` itself, so the unit conversion
+  // is always resolved at compile time and never loses precision.
+  template<Quantity Q>
+  class sharded_accumulator {
+  public:
+    using value_type = Q;
+    using unit = Q::unit;
+    using rep = Q::rep;
+    using dimension = Q::dimension;
+
+  private:
+    struct alignas(detail::cache_line_size) shard {
+      std::atomic<rep> value{quantity_values<rep>::zero()};
+    };
+
+    std::size_t mask_;
+    std::unique_ptr<shard[]> shards_;
+
+    shard& local_shard() noexcept { return shards_[detail::this_thread_index() & mask_]; }
+
+  public:
+    // The number of shards is rounded up to a power of 2
+    explicit sharded_accumulator(std::size_t shards = std::thread::hardware_concurrency()):
+        mask_(std::bit_ceil(shards == 0 ? std::size_t(1) : shards) - 1), shards_(std::make_unique<shard[]>(mask_ + 1))
+    {
+    }
+
+    sharded_accumulator(const sharded_accumulator&) = delete;
+    sharded_accumulator& operator=(const sharded_accumulator&) = delete;
+
+    [[nodiscard]] std::size_t shard_count() const noexcept { return mask_ + 1; }
+
+    template<Quantity Q2>
+        requires same_dim<dimension, typename Q2::dimension> &&
+                 std::same_as<common_quantity<value_type, Q2, rep>, value_type>
+    void add(const Q2& q) noexcept
+    {
+      // a shard is shared only when there are more threads than shards, so a relaxed RMW is uncontended
+      detail::atomic_fetch_add(local_shard().value, quantity_cast<value_type>(q).count(), std::memory_order_relaxed);
+    }
+
+    // Not a snapshot - concurrent updates may or may not be included
+    [[nodiscard]] value_type value() const noexcept
+    {
+      rep sum = quantity_values<rep>::zero();
+      for(std::size_t i = 0; i <= mask_; ++i) sum += shards_[i].value.load(std::memory_order_relaxed);
+      return value_type(sum);
+    }
+
+    // Returns the accumulated value and starts again from zero
+    value_type reset() noexcept
+    {
+      rep sum = quantity_values<rep>::zero();
+      for(std::size_t i = 0; i <= mask_; ++i)
+        sum += shards_[i].value.exchange(quantity_values<rep>::zero(), std::memory_order_relaxed);
+      return value_type(sum);
+    }
+  };
+
+}  // namespace units
@@ -0,0 +1,128 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/quantity.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace units {
+
+  // running_statistics
+
+  // Single-pass mean and variance of a stream of quantities (Welford's algorithm). The mean and the
+  // standard deviation are expressed in the unit of `Q`, the variance in its square (i.e. `square_metre`
+  // for `metre`). Integral representations are accumulated as `double`.
+  //
+  // Partial accumulators can be merged (Chan et al.), so a stream may be split across threads and
+  // reduced at the end.
+  template<Quantity Q>
+  class running_statistics {
+  public:
+    using value_type = Q;
+    using unit = Q::unit;
+    using rep = std::conditional_t<treat_as_floating_point<typename Q::rep>, typename Q::rep, double>;
+    using mean_type = quantity<unit, rep>;
+    using variance_type =
+        quantity<downcast<units::unit<dimension_pow<typename unit::dimension, 2>, ratio_pow<typename unit::ratio, 2>>>, rep>;
+
+  private:
+    std::uint64_t count_ = 0;
+    rep mean_ = 0;
+    rep m2_ = 0;  // sum of squared differences from the mean
+
+  public:
+    constexpr void add(const mean_type& x) noexcept
+    {
+      ++count_;
+      const rep delta = x.count() - mean_;
+      mean_ += delta / static_cast<rep>(count_);
+      m2_ += delta * (x.count() - mean_);
+    }
+
+    // Batch update. The mean and the squared deviations of the batch are computed in two passes of
+    // independent lanes, which compilers vectorize, and then merged into the accumulator.
+    void add(std::span<const value_type> xs) noexcept
+    {
+      constexpr std::size_t lanes = 4;
+      const std::size_t n = xs.size();
+      if(n == 0) return;
+      const std::size_t tail = n - n % lanes;
+
+      rep sum[lanes] = {};
+      for(std::size_t i = 0; i < tail; i += lanes)
+        for(std::size_t l = 0; l < lanes; ++l) sum[l] += static_cast<rep>(xs[i + l].count());
+      for(std::size_t i = tail; i < n; ++i) sum[0] += static_cast<rep>(xs[i].count());
+      const rep mean = (sum[0] + sum[1] + sum[2] + sum[3]) / static_cast<rep>(n);
+
+      rep m2[lanes] = {};
+      for(std::size_t i = 0; i < tail; i += lanes)
+        for(std::size_t l = 0; l < lanes; ++l) {
+          const rep d = static_cast<rep>(xs[i + l].count()) - mean;
+          m2[l] += d * d;
+        }
+      for(std::size_t i = tail; i < n; ++i) {
+        const rep d = static_cast<rep>(xs[i].count()) - mean;
+        m2[0] += d * d;
+      }
+
+      combine(n, mean, m2[0] + m2[1] + m2[2] + m2[3]);
+    }
+
+    constexpr void merge(const running_statistics& other) noexcept { combine(other.count_, other.mean_, other.m2_); }
+
+    [[nodiscard]] constexpr std::uint64_t count() const noexcept { return count_; }
+    [[nodiscard]] constexpr mean_type mean() const noexcept { return mean_type(mean_); }
+
+    // Population variance, zero for fewer than 2 values
+    [[nodiscard]] constexpr variance_type variance() const noexcept
+    {
+      return variance_type(count_ < 2 ? rep(0) : m2_ / static_cast<rep>(count_));
+    }
+
+    // Unbiased sample variance, zero for fewer than 2 values
+    [[nodiscard]] constexpr variance_type sample_variance() const noexcept
+    {
+      return variance_type(count_ < 2 ? rep(0) : m2_ / static_cast<rep>(count_ - 1));
+    }
+
+    [[nodiscard]] mean_type stddev() const noexcept { return mean_type(std::sqrt(variance().count())); }
+    [[nodiscard]] mean_type sample_stddev() const noexcept { return mean_type(std::sqrt(sample_variance().count())); }
+
+  private:
+    constexpr void combine(std::uint64_t count, rep mean, rep m2) noexcept
+    {
+      if(count == 0) return;
+      const std::uint64_t total = count_ + count;
+      const rep delta = mean - mean_;
+      const rep weight = static_cast<rep>(count) / static_cast<rep>(total);
+      mean_ += delta * weight;
+      m2_ += m2 + delta * delta * static_cast<rep>(count_) * weight;
+      count_ = total;
+    }
+  };
+
+}  // namespace units
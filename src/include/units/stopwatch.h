@@ -0,0 +1,131 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/chrono.h>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <utility>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define UNITS_HAS_TSC_CLOCK 1
+#endif
+
+namespace units {
+
+#ifdef UNITS_HAS_TSC_CLOCK
+
+  namespace detail {
+
+    // Measures the TSC frequency against `steady_clock` over a short busy-wait. Done once per process.
+    [[nodiscard]] inline double calibrate_tsc_ns_per_tick() noexcept
+    {
+      using namespace std::chrono;
+      const auto t0 = steady_clock::now();
+      const std::uint64_t c0 = __rdtsc();
+      while(steady_clock::now() - t0 < milliseconds(10)) {
+      }
+      const auto t1 = steady_clock::now();
+      const std::uint64_t c1 = __rdtsc();
+      return static_cast<double>(duration_cast<nanoseconds>(t1 - t0).count()) / static_cast<double>(c1 - c0);
+    }
+
+    [[nodiscard]] inline double tsc_ns_per_tick() noexcept
+    {
+      static const double ns_per_tick = calibrate_tsc_ns_per_tick();
+      return ns_per_tick;
+    }
+
+  }  // namespace detail
+
+  // tsc_clock
+
+  // Clock reading the CPU time-stamp counter. It is much cheaper than `steady_clock` but it is only
+  // monotonic across cores on CPUs with an invariant TSC. Calibration takes ~10 ms on the first use,
+  // call `tsc_clock::calibrate()` at startup to keep it off the hot path.
+  struct tsc_clock {
+    using rep = std::int64_t;
+    using period = std::nano;
+    using duration = std::chrono::nanoseconds;
+    using time_point = std::chrono::time_point<tsc_clock>;
+    static constexpr bool is_steady = true;
+
+    static void calibrate() noexcept { (void)detail::tsc_ns_per_tick(); }
+
+    [[nodiscard]] static time_point now() noexcept
+    {
+      return time_point(duration(static_cast<rep>(static_cast<double>(__rdtsc()) * detail::tsc_ns_per_tick())));
+    }
+  };
+
+#endif
+
+  // basic_stopwatch
+
+  // Measures time elapsed since its construction (or the last restart) with a monotonic clock
+  template<typename Clock>
+      requires Clock::is_steady
+  class basic_stopwatch {
+    Clock::time_point start_ = Clock::now();
+
+  public:
+    using clock = Clock;
+
+    void restart() noexcept { start_ = Clock::now(); }
+
+    [[nodiscard]] quantity<nanosecond, std::int64_t> elapsed() const noexcept
+    {
+      return quantity_cast<quantity<nanosecond, std::int64_t>>(Clock::now() - start_);
+    }
+
+    // Returns the elapsed time and restarts the measurement with the same clock reading
+    quantity<nanosecond, std::int64_t> lap() noexcept
+    {
+      const auto now = Clock::now();
+      const auto elapsed = quantity_cast<quantity<nanosecond, std::int64_t>>(now - start_);
+      start_ = now;
+      return elapsed;
+    }
+  };
+
+  using stopwatch = basic_stopwatch<std::chrono::steady_clock>;
+
+  // scoped_timer
+
+  // Passes the lifetime of the timer as `quantity<nanosecond, std::int64_t>` to `f` at scope exit
+  template<typename F, typename Clock = std::chrono::steady_clock>
+      requires std::invocable<F&, quantity<nanosecond, std::int64_t>>
+  class scoped_timer {
+    F f_;
+    basic_stopwatch<Clock> stopwatch_;
+
+  public:
+    explicit scoped_timer(F f): f_(std::move(f)) {}
+    scoped_timer(const scoped_timer&) = delete;
+    scoped_timer& operator=(const scoped_timer&) = delete;
+    ~scoped_timer() { f_(stopwatch_.elapsed()); }
+  };
+
+}  // namespace units
@@ -0,0 +1,208 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/bits/type_list.h>
+#include <units/bits/unit_list.h>
+#include <units/dimension_code.h>
+#include <units/unit.h>
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace units {
+
+  // fnv1a
+
+  namespace detail {
+
+    inline constexpr std::uint64_t fnv1a_offset = 14695981039346656037ull;
+    inline constexpr std::uint64_t fnv1a_prime = 1099511628211ull;
+
+    [[nodiscard]] constexpr std::uint64_t fnv1a(std::string_view txt, std::uint64_t h = fnv1a_offset) noexcept
+    {
+      for(const char ch : txt) {
+        h ^= static_cast<unsigned char>(ch);
+        h *= fnv1a_prime;
+      }
+      return h;
+    }
+
+  }  // namespace detail
+
+  // symbol_table
+
+  struct symbol_table_entry {
+    std::string_view symbol;
+    dimension_code dimension;
+    std::intmax_t num = 1;
+    std::intmax_t den = 1;
+  };
+
+  namespace detail {
+
+    template<Unit U>
+    [[nodiscard]] constexpr symbol_table_entry make_symbol_table_entry() noexcept
+    {
+      return {std::string_view(U::symbol.c_str(), U::symbol.size()), dimension_code_of<typename U::dimension>,
+              U::ratio::num, U::ratio::den};
+    }
+
+    [[nodiscard]] constexpr std::size_t symbol_table_capacity(std::size_t n) noexcept
+    {
+      std::size_t capacity = 1;
+      while(capacity < n + n / 4)
+        capacity *= 2;
+      return capacity;
+    }
+
+    // Perfect hash built with the "hash and displace" scheme: the upper bits of the hash select a bucket,
+    // every bucket stores a displacement XOR-ed with the lower bits to get a unique slot.
+    template<std::size_t N>
+    struct perfect_hash {
+      static constexpr std::size_t capacity = symbol_table_capacity(N);
+      static constexpr std::size_t buckets = capacity / 2 > 0 ? capacity / 2 : 1;
+
+      bool valid = false;
+      std::uint64_t seed = 0;
+      std::array<std::uint32_t, buckets> displacement{};
+      std::array<std::size_t, capacity> slot_index{};  // index of an element in a slot or N for an empty one
+
+      [[nodiscard]] static constexpr std::uint64_t hash(std::string_view symbol, std::uint64_t seed) noexcept
+      {
+        // FNV-1a followed by the MurmurHash3 finalizer so that the low bits depend on all the input
+        std::uint64_t h = fnv1a(symbol, fnv1a_offset ^ seed);
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        return h;
+      }
+
+      [[nodiscard]] static constexpr std::size_t bucket(std::uint64_t h) noexcept { return (h >> 32) % buckets; }
+
+      [[nodiscard]] constexpr std::size_t slot(std::uint64_t h) const noexcept
+      {
+        return (h ^ displacement[bucket(h)]) & (capacity - 1);
+      }
+
+      constexpr bool try_build(const std::array<symbol_table_entry, N>& entries)
+      {
+        std::array<std::uint64_t, N> hashes{};
+        std::array<std::size_t, buckets> bucket_size{};
+        for(std::size_t i = 0; i != N; ++i) {
+          hashes[i] = hash(entries[i].symbol, seed);
+          ++bucket_size[bucket(hashes[i])];
+        }
+
+        slot_index.fill(N);
+        displacement.fill(0);
+
+        // place the most populated buckets first
+        for(std::size_t size = N; size > 0; --size) {
+          for(std::size_t b = 0; b != buckets; ++b) {
+            if(bucket_size[b] != size)
+              continue;
+
+            bool placed = false;
+            for(std::uint32_t d = 0; d != capacity && !placed; ++d) {
+              std::array<bool, capacity> taken{};
+              placed = true;
+              for(std::size_t i = 0; i != N && placed; ++i) {
+                if(bucket(hashes[i]) != b)
+                  continue;
+                const std::size_t s = (hashes[i] ^ d) & (capacity - 1);
+                if(slot_index[s] != N || taken[s])
+                  placed = false;
+                else
+                  taken[s] = true;
+              }
+              if(placed) {
+                displacement[b] = d;
+                for(std::size_t i = 0; i != N; ++i)
+                  if(bucket(hashes[i]) == b)
+                    slot_index[slot(hashes[i])] = i;
+              }
+            }
+            if(!placed)
+              return false;
+          }
+        }
+        return true;
+      }
+    };
+
+    template<std::size_t N>
+    [[nodiscard]] constexpr bool unique_symbols(const std::array<symbol_table_entry, N>& entries) noexcept
+    {
+      for(std::size_t i = 0; i != N; ++i)
+        for(std::size_t j = i + 1; j != N; ++j)
+          if(entries[i].symbol == entries[j].symbol)
+            return false;
+      return true;
+    }
+
+    template<std::size_t N>
+    [[nodiscard]] constexpr perfect_hash<N> make_perfect_hash(const std::array<symbol_table_entry, N>& entries)
+    {
+      perfect_hash<N> ph;
+      for(std::uint64_t seed = 0; seed != 64 && !ph.valid; ++seed) {
+        ph.seed = seed;
+        ph.valid = ph.try_build(entries);
+      }
+      return ph;
+    }
+
+  }  // namespace detail
+
+  template<TypeList List>
+  class symbol_table;
+
+  template<template<typename...> typename List, Unit... Us>
+    requires (EncodableDimension<typename Us::dimension> && ...)
+  class symbol_table<List<Us...>> {
+    static constexpr std::size_t size_ = sizeof...(Us);
+    static constexpr std::array<symbol_table_entry, size_> entries_ = {detail::make_symbol_table_entry<Us>()...};
+    static_assert(detail::unique_symbols(entries_), "Unit symbols in a symbol table must be unique");
+    static constexpr detail::perfect_hash<size_> hash_ = detail::make_perfect_hash(entries_);
+    static_assert(hash_.valid, "Unable to build a perfect hash for the provided unit symbols");
+    static constexpr auto slots_ = []{
+      std::array<symbol_table_entry, detail::perfect_hash<size_>::capacity> slots{};
+      for(std::size_t s = 0; s != slots.size(); ++s)
+        if(hash_.slot_index[s] != size_)
+          slots[s] = entries_[hash_.slot_index[s]];
+      return slots;
+    }();
+
+  public:
+    [[nodiscard]] static constexpr std::size_t size() noexcept { return size_; }
+
+    [[nodiscard]] static constexpr const symbol_table_entry* find(std::string_view symbol) noexcept
+    {
+      const symbol_table_entry& e = slots_[hash_.slot(hash_.hash(symbol, hash_.seed))];
+      return !e.symbol.empty() && e.symbol == symbol ? &e : nullptr;
+    }
+
+    [[nodiscard]] static constexpr bool contains(std::string_view symbol) noexcept { return find(symbol) != nullptr; }
+  };
+
+}  // namespace units
@@ -0,0 +1,432 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/dimensions/angle.h>
+#include <units/dimensions/dimensionless.h>
+#include <units/math.h>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <ranges>
+#include <type_traits>
+
+// Transcendental functions of quantities
+//
+// `exponential()` and `log()` take only `Dimensionless` quantities and `sin()` and `cos()` only `Angle`
+// quantities, so passing a length or a time does not compile. The results are plain scalars.
+//
+// For `float` and `double` (and integral) representations the functions use branch-free polynomial
+// kernels written so that the compiler vectorizes the range overloads. The unit ratio is folded into
+// the kernel constants at compile time - an argument in degrees or in percent is never converted to
+// radians or to one first, so a typed call costs the same as the same kernel on a raw `double`. Other
+// representations use the standard functions after converting the argument.
+
+namespace units {
+
+  namespace detail {
+
+    inline constexpr long double pi_ld = 3.141592653589793238462643383279502884L;
+    inline constexpr long double ln2_ld = 0.693147180559945309417232121458176568L;
+
+    // Integral arguments are computed in `double`
+    template<typename Rep>
+    using math_rep = std::conditional_t<std::is_floating_point_v<Rep>, Rep, double>;
+
+    // The kernels compute in `double`, `long double` uses the standard functions
+    template<typename Rep>
+    inline constexpr bool has_math_kernel = std::is_arithmetic_v<Rep> && sizeof(math_rep<Rep>) <= sizeof(double);
+
+    // The ratio of a unit as a number
+    template<typename R>
+    inline constexpr long double ratio_value = static_cast<long double>(R::num) / static_cast<long double>(R::den);
+
+    // ln(x) for x > 0 in constant expressions
+    [[nodiscard]] constexpr long double constexpr_log(long double x)
+    {
+      int e = 0;
+      while(x >= 2) { x /= 2; ++e; }
+      while(x < 1) { x *= 2; --e; }
+      // ln(x) = 2 atanh((x - 1) / (x + 1)) with x in [1, 2)
+      const long double s = (x - 1) / (x + 1);
+      const long double s2 = s * s;
+      long double sum = 0;
+      long double term = s;
+      for(int i = 1; sum + term / i != sum; i += 2) {
+        sum += term / i;
+        term *= s2;
+      }
+      return e * ln2_ld + 2 * sum;
+    }
+
+    // `v` (> 0) truncated to its `Bits` most significant bits, so that its product with an integer of
+    // up to `53 - Bits` bits is exact in `double`
+    template<int Bits>
+    [[nodiscard]] constexpr long double leading_bits(long double v)
+    {
+      constexpr long double lo = static_cast<long double>(std::int64_t(1) << (Bits - 1));
+      long double scale = 1;
+      while(v * scale < lo) scale *= 2;
+      while(v * scale >= 2 * lo) scale /= 2;
+      return static_cast<long double>(static_cast<std::int64_t>(v * scale)) / scale;
+    }
+
+    // Coefficients `c[i] * k^(step * i + offset)`
+    template<std::size_t N>
+    [[nodiscard]] constexpr std::array<double, N> scale_coefficients(const std::array<long double, N>& c, long double k,
+                                                                     int step, int offset)
+    {
+      std::array<double, N> ret{};
+      for(std::size_t i = 0; i < N; ++i) {
+        long double p = 1;
+        for(int j = 0; j < step * static_cast<int>(i) + offset; ++j) p *= k;
+        ret[i] = static_cast<double>(c[i] * p);
+      }
+      return ret;
+    }
+
+    // c[0] + c[1] x + ... + c[N-1] x^(N-1), unrolled at compile time so that the loops calling the
+    // kernels have a straight-line body
+    template<std::size_t I = 0, std::size_t N>
+    [[nodiscard]] constexpr double horner(double x, const std::array<double, N>& c) noexcept
+    {
+      if constexpr(I == N - 1)
+        return c[I];
+      else
+        return horner<I + 1>(x, c) * x + c[I];
+    }
+
+    // Adding 1.5 * 2^52 to a double of magnitude below 2^51 rounds it to an integer that is then
+    // held in the low mantissa bits
+    inline constexpr double shifter = 0x1.8p52;
+
+    // 2^n for an integral n in [-1022, 1023] without a conversion to an integer type
+    [[nodiscard]] constexpr double pow2(double n) noexcept
+    {
+      constexpr std::uint64_t bias = 1023 - std::bit_cast<std::uint64_t>(shifter);
+      return std::bit_cast<double>((std::bit_cast<std::uint64_t>(n + shifter) + bias) << 52);
+    }
+
+    // sin, cos
+
+    // Cephes minimax polynomials on [-pi/4, pi/4]:
+    // sin(x) = x + x^3 P(x^2), cos(x) = 1 - x^2/2 + x^4 Q(x^2)
+    inline constexpr std::array<long double, 6> sin_coefficients = {
+        -1.66666666666666307295E-1L, 8.33333333332211858878E-3L, -1.98412698295895385996E-4L,
+        2.75573136213857245213E-6L, -2.50507477628578072866E-8L, 1.58962301576546568060E-10L};
+    inline constexpr std::array<long double, 6> cos_coefficients = {
+        4.16666666666665929218E-2L, -1.38888888888730564116E-3L, 2.48015872888517045348E-5L,
+        -2.75573141792967388112E-7L, 2.08757008419747316778E-9L, -1.13585365213876817300E-11L};
+
+    // Constants of the kernel for an argument in a unit with ratio `R` to the radian. With
+    // x = k u the polynomials become
+    //   sin(x) = u (k + u^2 P'(u^2)), P'_i = P_i k^(2i + 3)
+    //   cos(x) = 1 + u^2 (-k^2/2 + u^2 Q'(u^2)), Q'_i = Q_i k^(2i + 4)
+    // and the reduction by multiples of pi/4 is done directly in the unit of the argument.
+    template<typename R>
+    struct sincos_constants {
+      static constexpr long double k = ratio_value<R>;
+      static constexpr long double quarter = pi_ld / 4 / k;
+      static constexpr double k_d = static_cast<double>(k);
+      static constexpr double half_k2 = static_cast<double>(k * k / 2);
+      static constexpr double octants = static_cast<double>(1 / quarter);
+      // Cody-Waite split of pi/4: dp1 and dp2 have 24 bits so that their products with an octant
+      // number of up to 29 bits are exact
+      static constexpr double dp1 = static_cast<double>(leading_bits<24>(quarter));
+      static constexpr double dp2 = static_cast<double>(leading_bits<24>(quarter - dp1));
+      static constexpr double dp3 = static_cast<double>(quarter - dp1 - dp2);
+      // beyond that the standard functions are used
+      static constexpr double max_arg = static_cast<double>((std::int64_t(1) << 29) * quarter);
+      static constexpr auto sin = scale_coefficients(sin_coefficients, k, 2, 3);
+      static constexpr auto cos = scale_coefficients(cos_coefficients, k, 2, 4);
+    };
+
+    template<typename R, bool Cos>
+    [[nodiscard]] constexpr double sincos_kernel(double u) noexcept
+    {
+      using c = sincos_constants<R>;
+      const double x = std::abs(u);
+      // nearest even octant j = 2m, so that the reduced argument is in [-pi/4, pi/4]; m is read from
+      // the mantissa bits instead of converting to an integer type
+      const double mf = x * (c::octants / 2) + shifter;
+      const auto m = std::bit_cast<std::uint64_t>(mf);
+      const double y = 2 * (mf - shifter);
+      const double z = ((x - y * c::dp1) - y * c::dp2) - y * c::dp3;
+      const double w = z * z;
+      const double s = z * (c::k_d + w * horner(w, c::sin));
+      const double co = 1. + w * (-c::half_k2 + w * horner(w, c::cos));
+      // The polynomial and the sign are chosen with bit masks. With a select the compiler moves the
+      // polynomials into branches, and a floating-point operation under a condition may trap, which
+      // keeps the loop from being vectorized.
+      const std::uint64_t use_cos = Cos ? ~m & 1 : m & 1;
+      const std::uint64_t mask = 0 - use_cos;
+      const std::uint64_t sign =
+          Cos ? ((m ^ (m << 1)) & 2) << 62 : (std::bit_cast<std::uint64_t>(u) ^ (m << 62)) & (std::uint64_t(1) << 63);
+      const std::uint64_t r = (std::bit_cast<std::uint64_t>(co) & mask) | (std::bit_cast<std::uint64_t>(s) & ~mask);
+      return std::bit_cast<double>(r ^ sign);
+    }
+
+    template<typename R>
+    [[nodiscard]] constexpr bool sincos_in_range(double u) noexcept
+    {
+      return std::abs(u) <= sincos_constants<R>::max_arg;
+    }
+
+    // exp
+
+    // Taylor polynomial of degree 13 on [-ln2/2, ln2/2] (truncation error below 4e-18)
+    inline constexpr std::array<long double, 14> exp_coefficients = []() {
+      std::array<long double, 14> c{};
+      long double f = 1;
+      for(std::size_t i = 0; i < c.size(); ++i) {
+        if(i > 0) f *= static_cast<long double>(i);
+        c[i] = 1 / f;
+      }
+      return c;
+    }();
+
+    // exp(k u) = 2^n exp(k r), with n the integer nearest to k u / ln2 and r = u - n ln2 / k
+    template<typename R>
+    struct exp_constants {
+      static constexpr long double k = ratio_value<R>;
+      static constexpr long double ln2 = ln2_ld / k;
+      static constexpr double log2e = static_cast<double>(1 / ln2);
+      static constexpr double ln2_hi = static_cast<double>(leading_bits<32>(ln2));
+      static constexpr double ln2_lo = static_cast<double>(ln2 - ln2_hi);
+      // arguments with a normal result; the standard function handles overflow, subnormal results
+      // and NaN
+      static constexpr double max_arg = static_cast<double>(709 / k);
+      static constexpr double min_arg = static_cast<double>(-708 / k);
+      static constexpr auto poly = scale_coefficients(exp_coefficients, k, 1, 0);
+    };
+
+    template<typename R>
+    [[nodiscard]] constexpr double exp_kernel(double u) noexcept
+    {
+      using c = exp_constants<R>;
+      const double n = (u * c::log2e + shifter) - shifter;
+      const double r = (u - n * c::ln2_hi) - n * c::ln2_lo;
+      return horner(r, c::poly) * pow2(n);
+    }
+
+    // log
+
+    // ln(m) = 2 atanh(s) = 2s + s^3 P(s^2), s = (m - 1) / (m + 1), with m in [sqrt(1/2), sqrt(2)]
+    // |s| < 0.172, so 11 terms of the series are below the rounding error
+    inline constexpr std::array<long double, 11> log_coefficients = []() {
+      std::array<long double, 11> c{};
+      for(std::size_t i = 0; i < c.size(); ++i) c[i] = 2.L / static_cast<long double>(2 * i + 3);
+      return c;
+    }();
+
+    // ln(k u) = ln(u) + ln(k)
+    template<typename R>
+    struct log_constants {
+      static constexpr double ln2_hi = static_cast<double>(leading_bits<32>(ln2_ld));
+      static constexpr double ln2_lo = static_cast<double>(ln2_ld - ln2_hi);
+      static constexpr double ln_k = static_cast<double>(constexpr_log(R::num) - constexpr_log(R::den));
+      static constexpr auto poly = scale_coefficients(log_coefficients, 1, 0, 0);
+    };
+
+    // Positive normal arguments only; the standard function handles zero, subnormals, negative
+    // numbers, infinity and NaN
+    template<typename R>
+    [[nodiscard]] constexpr double log_kernel(double u) noexcept
+    {
+      using c = log_constants<R>;
+      constexpr std::uint64_t mantissa = (std::uint64_t(1) << 52) - 1;
+      constexpr std::uint64_t sqrt_half = std::bit_cast<std::uint64_t>(0.70710678118654752);
+      // u = 2^e m with m in [sqrt(1/2), sqrt(2)), split with integer operations only: subtracting the
+      // mantissa of sqrt(1/2) borrows from the exponent exactly when the mantissa of u is below it
+      const auto t = std::bit_cast<std::uint64_t>(u) - (sqrt_half & mantissa);
+      const double m = std::bit_cast<double>((t & mantissa) + sqrt_half);
+      // the exponent is moved into the mantissa of 2^52 to turn it into a double
+      const double e = std::bit_cast<double>((t >> 52) | std::bit_cast<std::uint64_t>(0x1p52)) - (0x1p52 + 1022);
+      const double f = m - 1;
+      const double s = f / (2 + f);
+      const double s2 = s * s;
+      return e * c::ln2_hi + ((2 * s + s * s2 * horner(s2, c::poly)) + (e * c::ln2_lo + c::ln_k));
+    }
+
+    // Kernels with the range they cover and the standard function used outside of it
+
+    template<typename R>
+    struct sin_fn {
+      static constexpr double kernel(double u) noexcept { return sincos_kernel<R, false>(u); }
+      static constexpr bool in_range(double u) noexcept { return sincos_in_range<R>(u); }
+      template<typename T>
+      static T fallback(const T& u) { using std::sin; return sin(scale<R>(u)); }
+    };
+
+    template<typename R>
+    struct cos_fn {
+      static constexpr double kernel(double u) noexcept { return sincos_kernel<R, true>(u); }
+      static constexpr bool in_range(double u) noexcept { return sincos_in_range<R>(u); }
+      template<typename T>
+      static T fallback(const T& u) { using std::cos; return cos(scale<R>(u)); }
+    };
+
+    template<typename R>
+    struct exp_fn {
+      static constexpr double kernel(double u) noexcept { return exp_kernel<R>(u); }
+      static constexpr bool in_range(double u) noexcept
+      {
+        return (u <= exp_constants<R>::max_arg) & (u >= exp_constants<R>::min_arg);
+      }
+      template<typename T>
+      static T fallback(const T& u) { using std::exp; return exp(scale<R>(u)); }
+    };
+
+    template<typename R>
+    struct log_fn {
+      static constexpr double kernel(double u) noexcept { return log_kernel<R>(u); }
+      static constexpr bool in_range(double u) noexcept
+      {
+        return (u >= std::numeric_limits<double>::min()) & (u <= std::numeric_limits<double>::max());
+      }
+      template<typename T>
+      static T fallback(const T& u) { using std::log; return log(scale<R>(u)); }
+    };
+
+    template<typename F, typename Rep>
+    [[nodiscard]] math_rep<Rep> apply_math(const Rep& v) noexcept
+    {
+      using T = math_rep<Rep>;
+      if constexpr(has_math_kernel<Rep>) {
+        const auto u = static_cast<double>(v);
+        if(F::in_range(u)) [[likely]]
+          return static_cast<T>(F::kernel(u));
+        return static_cast<T>(F::fallback(u));
+      }
+      else {
+        return F::fallback(static_cast<T>(v));
+      }
+    }
+
+    template<typename In, typename Out>
+    concept MathRanges = std::ranges::contiguous_range<In> && std::ranges::sized_range<In> &&
+                         Quantity<std::ranges::range_value_t<In>> &&
+                         std::ranges::contiguous_range<Out> && std::ranges::sized_range<Out> &&
+                         std::is_assignable_v<std::ranges::range_reference_t<Out>,
+                                              math_rep<typename std::ranges::range_value_t<In>::rep>>;
+
+    template<typename F, typename In, typename Out>
+    void apply_math(const In& in, Out& out) noexcept
+    {
+      using rep = std::ranges::range_value_t<In>::rep;
+      using T = math_rep<rep>;
+      const auto n = std::ranges::size(in);
+      Expects(std::ranges::size(out) >= n);
+      const auto src = std::ranges::data(in);
+      const auto dst = std::ranges::data(out);
+      if constexpr(has_math_kernel<rep>) {
+        // branch-free pass that the compiler vectorizes, the rare arguments that the kernel does not
+        // cover are fixed up afterwards (the flag is a `double` so that its update is a blend of the
+        // same width as the data)
+        double fallback = 0;
+        for(std::size_t i = 0; i < n; ++i) {
+          const auto u = static_cast<double>(src[i].count());
+          dst[i] = static_cast<T>(F::kernel(u));
+          fallback = F::in_range(u) ? fallback : 1.;
+        }
+        if(fallback != 0) [[unlikely]] {
+          for(std::size_t i = 0; i < n; ++i) {
+            const auto u = static_cast<double>(src[i].count());
+            if(!F::in_range(u)) dst[i] = static_cast<T>(F::fallback(u));
+          }
+        }
+      }
+      else {
+        for(std::size_t i = 0; i < n; ++i) dst[i] = F::fallback(static_cast<T>(src[i].count()));
+      }
+    }
+
+  }  // namespace detail
+
+  // sin, cos
+
+  template<typename U, typename Rep>
+  [[nodiscard]] inline detail::math_rep<Rep> sin(const quantity<U, Rep>& q) noexcept
+    requires Angle<quantity<U, Rep>>
+  {
+    return detail::apply_math<detail::sin_fn<typename U::ratio>>(q.count());
+  }
+
+  template<typename U, typename Rep>
+  [[nodiscard]] inline detail::math_rep<Rep> cos(const quantity<U, Rep>& q) noexcept
+    requires Angle<quantity<U, Rep>>
+  {
+    return detail::apply_math<detail::cos_fn<typename U::ratio>>(q.count());
+  }
+
+  // exponential, log
+
+  // Named `exponential` because `units::exp` is the exponent of a dimension
+  template<typename U, typename Rep>
+  [[nodiscard]] inline detail::math_rep<Rep> exponential(const quantity<U, Rep>& q) noexcept
+    requires Dimensionless<quantity<U, Rep>>
+  {
+    return detail::apply_math<detail::exp_fn<typename U::ratio>>(q.count());
+  }
+
+  template<typename U, typename Rep>
+  [[nodiscard]] inline detail::math_rep<Rep> log(const quantity<U, Rep>& q) noexcept
+    requires Dimensionless<quantity<U, Rep>>
+  {
+    return detail::apply_math<detail::log_fn<typename U::ratio>>(q.count());
+  }
+
+  // Range overloads: `out[i] = f(in[i])` for the first `size(in)` elements of `out`
+
+  template<typename In, typename Out>
+    requires detail::MathRanges<In, Out> && Angle<std::ranges::range_value_t<In>>
+  void sin(const In& in, Out&& out) noexcept
+  {
+    detail::apply_math<detail::sin_fn<typename std::ranges::range_value_t<In>::unit::ratio>>(in, out);
+  }
+
+  template<typename In, typename Out>
+    requires detail::MathRanges<In, Out> && Angle<std::ranges::range_value_t<In>>
+  void cos(const In& in, Out&& out) noexcept
+  {
+    detail::apply_math<detail::cos_fn<typename std::ranges::range_value_t<In>::unit::ratio>>(in, out);
+  }
+
+  template<typename In, typename Out>
+    requires detail::MathRanges<In, Out> && Dimensionless<std::ranges::range_value_t<In>>
+  void exponential(const In& in, Out&& out) noexcept
+  {
+    detail::apply_math<detail::exp_fn<typename std::ranges::range_value_t<In>::unit::ratio>>(in, out);
+  }
+
+  template<typename In, typename Out>
+    requires detail::MathRanges<In, Out> && Dimensionless<std::ranges::range_value_t<In>>
+  void log(const In& in, Out&& out) noexcept
+  {
+    detail::apply_math<detail::log_fn<typename std::ranges::range_value_t<In>::unit::ratio>>(in, out);
+  }
+
+}  // namespace units
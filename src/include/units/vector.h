@@ -0,0 +1,328 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#pragma once
+
+#include <units/quantity.h>
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+
+namespace units {
+
+  namespace detail {
+
+    // Alignment of `Bytes` of packed data: the next power of 2, capped at a cache line, so that small
+    // vectors are loaded with a single SIMD instruction and never straddle a cache line
+    template<std::size_t Bytes, std::size_t MinAlign>
+    inline constexpr std::size_t simd_alignment = std::clamp(std::bit_ceil(Bytes), MinAlign, std::size_t(64));
+
+    // The quantity type of `Q1 * Q2` without evaluating the product
+    template<Quantity Q1, Quantity Q2>
+    using product_quantity = decltype(std::declval<Q1>() * std::declval<Q2>());
+
+    template<Quantity Q1, Quantity Q2>
+    using quotient_quantity = decltype(std::declval<Q1>() / std::declval<Q2>());
+
+  }  // namespace detail
+
+  // vec
+
+  // Fixed-size vector of quantities of one unit. The elements are stored as a packed, SIMD-aligned
+  // array of `Rep` (a `vec<3, quantity<metre>>` is 3 doubles aligned to 32 bytes), so the loops of
+  // the operations below work on raw values and compilers vectorize them.
+  //
+  // Element access returns quantities by value; `data()` exposes the raw representation values for
+  // hand-written kernels.
+  template<std::size_t N, Quantity Q>
+    requires (N > 0)
+  class vec {
+  public:
+    using value_type = Q;
+    using unit = Q::unit;
+    using rep = Q::rep;
+    using dimension = Q::dimension;
+
+  private:
+    alignas(detail::simd_alignment<N * sizeof(rep), alignof(rep)>) rep data_[N] = {};
+
+  public:
+    static constexpr std::size_t size() noexcept { return N; }
+
+    vec() = default;
+
+    template<Quantity... Qs>
+      requires (sizeof...(Qs) == N) && (std::convertible_to<Qs, value_type> && ...)
+    constexpr explicit(N == 1) vec(const Qs&... qs): data_{value_type(qs).count()...}
+    {
+    }
+
+    template<Quantity Q2>
+      requires std::convertible_to<Q2, value_type>
+    constexpr vec(const vec<N, Q2>& v)
+    {
+      for(std::size_t i = 0; i < N; ++i) data_[i] = value_type(v[i]).count();
+    }
+
+    // A vector with every element set to `q`
+    [[nodiscard]] static constexpr vec filled(const value_type& q) noexcept
+    {
+      vec v;
+      for(std::size_t i = 0; i < N; ++i) v.data_[i] = q.count();
+      return v;
+    }
+
+    [[nodiscard]] constexpr value_type operator[](std::size_t i) const
+    {
+      Expects(i < N);
+      return value_type(data_[i]);
+    }
+
+    constexpr void set(std::size_t i, const value_type& q)
+    {
+      Expects(i < N);
+      data_[i] = q.count();
+    }
+
+    [[nodiscard]] constexpr rep* data() noexcept { return data_; }
+    [[nodiscard]] constexpr const rep* data() const noexcept { return data_; }
+
+    [[nodiscard]] constexpr vec operator+() const { return *this; }
+
+    [[nodiscard]] constexpr vec operator-() const
+    {
+      vec ret;
+      for(std::size_t i = 0; i < N; ++i) ret.data_[i] = -data_[i];
+      return ret;
+    }
+
+    constexpr vec& operator+=(const vec& v)
+    {
+      for(std::size_t i = 0; i < N; ++i) data_[i] += v.data_[i];
+      return *this;
+    }
+
+    constexpr vec& operator-=(const vec& v)
+    {
+      for(std::size_t i = 0; i < N; ++i) data_[i] -= v.data_[i];
+      return *this;
+    }
+
+    constexpr vec& operator*=(const rep& s)
+    {
+      for(std::size_t i = 0; i < N; ++i) data_[i] *= s;
+      return *this;
+    }
+
+    constexpr vec& operator/=(const rep& s)
+    {
+      Expects(s != quantity_values<rep>::zero());
+      for(std::size_t i = 0; i < N; ++i) data_[i] /= s;
+      return *this;
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(const vec& lhs, const vec& rhs)
+    {
+      for(std::size_t i = 0; i < N; ++i)
+        if(lhs.data_[i] != rhs.data_[i]) return false;
+      return true;
+    }
+
+    template<class CharT, class Traits>
+    friend std::basic_ostream<CharT, Traits>& operator<<(std::basic_ostream<CharT, Traits>& os, const vec& v)
+    {
+      os << '(';
+      for(std::size_t i = 0; i < N; ++i) {
+        if(i > 0) os << ", ";
+        os << v[i];
+      }
+      return os << ')';
+    }
+  };
+
+  template<Quantity Q, Quantity... Qs>
+  vec(Q, Qs...) -> vec<1 + sizeof...(Qs), Q>;
+
+  namespace detail {
+
+    // v[i] expressed in the unit of `To`
+    template<Quantity To, std::size_t N, Quantity Q>
+    [[nodiscard]] constexpr To::rep element_as(const vec<N, Q>& v, std::size_t i)
+    {
+      return quantity_cast<To>(v[i]).count();
+    }
+
+  }  // namespace detail
+
+  // Addition and subtraction of vectors of the same dimension give a vector of the common quantity
+
+  template<std::size_t N, Quantity Q1, Quantity Q2>
+  [[nodiscard]] constexpr auto operator+(const vec<N, Q1>& lhs, const vec<N, Q2>& rhs)
+    requires same_dim<typename Q1::dimension, typename Q2::dimension>
+  {
+    using cq = common_quantity<Q1, Q2>;
+    vec<N, cq> ret;
+    for(std::size_t i = 0; i < N; ++i)
+      ret.data()[i] = detail::element_as<cq>(lhs, i) + detail::element_as<cq>(rhs, i);
+    return ret;
+  }
+
+  template<std::size_t N, Quantity Q1, Quantity Q2>
+  [[nodiscard]] constexpr auto operator-(const vec<N, Q1>& lhs, const vec<N, Q2>& rhs)
+    requires same_dim<typename Q1::dimension, typename Q2::dimension>
+  {
+    using cq = common_quantity<Q1, Q2>;
+    vec<N, cq> ret;
+    for(std::size_t i = 0; i < N; ++i)
+      ret.data()[i] = detail::element_as<cq>(lhs, i) - detail::element_as<cq>(rhs, i);
+    return ret;
+  }
+
+  // Scaling by a scalar keeps the unit, scaling by a quantity multiplies the dimensions
+
+  template<std::size_t N, Quantity Q, Scalar S>
+  [[nodiscard]] constexpr auto operator*(const vec<N, Q>& v, const S& s)
+    requires (!Quantity<S>)
+  {
+    using ret_q = decltype(v[0] * s);
+    vec<N, ret_q> ret;
+    for(std::size_t i = 0; i < N; ++i) ret.data()[i] = v.data()[i] * s;
+    return ret;
+  }
+
+  template<Scalar S, std::size_t N, Quantity Q>
+  [[nodiscard]] constexpr auto operator*(const S& s, const vec<N, Q>& v)
+    requires (!Quantity<S>)
+  {
+    return v * s;
+  }
+
+  template<std::size_t N, Quantity Q, Scalar S>
+  [[nodiscard]] constexpr auto operator/(const vec<N, Q>& v, const S& s)
+    requires (!Quantity<S>)
+  {
+    Expects(s != quantity_values<S>::zero());
+    using ret_q = decltype(v[0] / s);
+    vec<N, ret_q> ret;
+    for(std::size_t i = 0; i < N; ++i) ret.data()[i] = v.data()[i] / s;
+    return ret;
+  }
+
+  // The unit of the product is `unit<dimension_multiply<...>, ratio_multiply<...>>`, so the raw values
+  // are multiplied without any rescaling
+  template<std::size_t N, Quantity Q1, Quantity Q2>
+  [[nodiscard]] constexpr auto operator*(const vec<N, Q1>& v, const Q2& q)
+    requires Quantity<detail::product_quantity<Q1, Q2>>
+  {
+    vec<N, detail::product_quantity<Q1, Q2>> ret;
+    for(std::size_t i = 0; i < N; ++i) ret.data()[i] = v.data()[i] * q.count();
+    return ret;
+  }
+
+  template<Quantity Q1, std::size_t N, Quantity Q2>
+  [[nodiscard]] constexpr auto operator*(const Q1& q, const vec<N, Q2>& v)
+    requires Quantity<detail::product_quantity<Q2, Q1>>
+  {
+    return v * q;
+  }
+
+  template<std::size_t N, Quantity Q1, Quantity Q2>
+  [[nodiscard]] constexpr auto operator/(const vec<N, Q1>& v, const Q2& q)
+    requires Quantity<detail::quotient_quantity<Q1, Q2>>
+  {
+    Expects(q != std::remove_cvref_t<decltype(q)>(0));
+    using ret_q = detail::quotient_quantity<Q1, Q2>;
+    vec<N, ret_q> ret;
+    for(std::size_t i = 0; i < N; ++i) ret.data()[i] = (v[i] / q).count();
+    return ret;
+  }
+
+  // Element-wise products and quotients; the result dimension is `dimension_multiply` or
+  // `dimension_divide` of the element dimensions
+
+  template<std::size_t N, Quantity Q1, Quantity Q2>
+  [[nodiscard]] constexpr auto elementwise_multiply(const vec<N, Q1>& lhs, const vec<N, Q2>& rhs)
+    requires Quantity<detail::product_quantity<Q1, Q2>>
+  {
+    vec<N, detail::product_quantity<Q1, Q2>> ret;
+    for(std::size_t i = 0; i < N; ++i) ret.data()[i] = lhs.data()[i] * rhs.data()[i];
+    return ret;
+  }
+
+  template<std::size_t N, Quantity Q1, Quantity Q2>
+  [[nodiscard]] constexpr auto elementwise_divide(const vec<N, Q1>& lhs, const vec<N, Q2>& rhs)
+    requires Quantity<detail::quotient_quantity<Q1, Q2>>
+  {
+    vec<N, detail::quotient_quantity<Q1, Q2>> ret;
+    for(std::size_t i = 0; i < N; ++i) ret.data()[i] = (lhs[i] / rhs[i]).count();
+    return ret;
+  }
+
+  // dot
+
+  // The products are summed on raw values and the unit is applied once at the end. The result is a
+  // `Scalar` if the dimensions cancel out (i.e. a length and a wavenumber), as for `Q1 * Q2`.
+  template<std::size_t N, Quantity Q1, Quantity Q2>
+  [[nodiscard]] constexpr auto dot(const vec<N, Q1>& lhs, const vec<N, Q2>& rhs)
+  {
+    using rep = decltype(lhs.data()[0] * rhs.data()[0]);
+    rep sum = lhs.data()[0] * rhs.data()[0];
+    for(std::size_t i = 1; i < N; ++i) sum += lhs.data()[i] * rhs.data()[i];
+    return quantity<typename Q1::unit, rep>(sum) * quantity<typename Q2::unit, rep>(1);
+  }
+
+  // cross
+
+  // The result dimension is the product of the operand dimensions, i.e. a position and a force give
+  // a torque (with the dimension of energy)
+  template<Quantity Q1, Quantity Q2>
+  [[nodiscard]] constexpr auto cross(const vec<3, Q1>& lhs, const vec<3, Q2>& rhs)
+    requires Quantity<detail::product_quantity<Q1, Q2>>
+  {
+    const auto a = lhs.data();
+    const auto b = rhs.data();
+    vec<3, detail::product_quantity<Q1, Q2>> ret;
+    ret.data()[0] = a[1] * b[2] - a[2] * b[1];
+    ret.data()[1] = a[2] * b[0] - a[0] * b[2];
+    ret.data()[2] = a[0] * b[1] - a[1] * b[0];
+    return ret;
+  }
+
+  // norm
+
+  // Euclidean length in the unit of the vector with a floating-point representation
+  template<std::size_t N, Quantity Q>
+  [[nodiscard]] Quantity AUTO norm(const vec<N, Q>& v)
+  {
+    using std::sqrt;
+    const auto d = v.data();
+    auto sum = d[0] * d[0];
+    for(std::size_t i = 1; i < N; ++i) sum += d[i] * d[i];
+    const auto r = sqrt(sum);
+    return quantity<typename Q::unit, std::remove_const_t<decltype(r)>>(r);
+  }
+
+}  // namespace units
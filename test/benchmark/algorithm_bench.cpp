@@ -0,0 +1,122 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/algorithm.h>
+#include <units/dimensions/energy.h>
+#include <units/dimensions/force.h>
+#include <units/dimensions/length.h>
+#include <benchmark/benchmark.h>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#if defined(UNITS_PARALLEL_BACKEND_OPENMP)
+#include <omp.h>
+#elif defined(UNITS_PARALLEL_BACKEND_TBB)
+#include <tbb/global_control.h>
+#endif
+
+using namespace units;
+
+namespace {
+
+  constexpr std::size_t size = 1 << 22;
+
+  // Limits the number of threads of the parallel backend for the lifetime of the object
+  class thread_limit {
+#if defined(UNITS_PARALLEL_BACKEND_TBB)
+    tbb::global_control control_;
+#endif
+  public:
+    explicit thread_limit([[maybe_unused]] int threads)
+#if defined(UNITS_PARALLEL_BACKEND_TBB)
+        : control_(tbb::global_control::max_allowed_parallelism, static_cast<std::size_t>(threads))
+#endif
+    {
+#if defined(UNITS_PARALLEL_BACKEND_OPENMP)
+      omp_set_num_threads(threads);
+#endif
+    }
+  };
+
+  void thread_counts(benchmark::internal::Benchmark* b)
+  {
+    const int max = static_cast<int>(std::thread::hardware_concurrency());
+    for(int t = 1; t < max; t *= 2) b->Arg(t);
+    b->Arg(max);
+  }
+
+  void raw_dot_product(benchmark::State& state)
+  {
+    const thread_limit limit(static_cast<int>(state.range(0)));
+    const std::vector<double> distances(size, 2.0), forces(size, 3.0);
+    for(auto _ : state) {
+      const double work = std::transform_reduce(std::execution::par_unseq, distances.begin(), distances.end(),
+                                                forces.begin(), 0.0);
+      benchmark::DoNotOptimize(work);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(size));
+  }
+  BENCHMARK(raw_dot_product)->Apply(thread_counts)->UseRealTime();
+
+  void quantity_dot_product(benchmark::State& state)
+  {
+    const thread_limit limit(static_cast<int>(state.range(0)));
+    const std::vector<quantity<metre>> distances(size, quantity<metre>(2.0));
+    const std::vector<quantity<newton>> forces(size, quantity<newton>(3.0));
+    for(auto _ : state) {
+      const quantity<joule> work = units::transform_reduce(std::execution::par_unseq, distances, forces);
+      benchmark::DoNotOptimize(work);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(size));
+  }
+  BENCHMARK(quantity_dot_product)->Apply(thread_counts)->UseRealTime();
+
+  void raw_reduce(benchmark::State& state)
+  {
+    const thread_limit limit(static_cast<int>(state.range(0)));
+    const std::vector<double> distances(size, 2.0);
+    for(auto _ : state) {
+      const double total = std::reduce(std::execution::par_unseq, distances.begin(), distances.end(), 0.0);
+      benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(size));
+  }
+  BENCHMARK(raw_reduce)->Apply(thread_counts)->UseRealTime();
+
+  void quantity_reduce(benchmark::State& state)
+  {
+    const thread_limit limit(static_cast<int>(state.range(0)));
+    const std::vector<quantity<metre>> distances(size, quantity<metre>(2.0));
+    for(auto _ : state) {
+      const quantity<metre> total = units::reduce(std::execution::par_unseq, distances);
+      benchmark::DoNotOptimize(total);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(size));
+  }
+  BENCHMARK(quantity_reduce)->Apply(thread_counts)->UseRealTime();
+
+}  // namespace
+
+BENCHMARK_MAIN();
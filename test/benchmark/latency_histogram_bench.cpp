@@ -0,0 +1,71 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/latency_histogram.h>
+#include <units/stopwatch.h>
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdint>
+
+using namespace units;
+
+namespace {
+
+  latency_histogram<> histogram;
+
+  void latency_histogram_record(benchmark::State& state)
+  {
+    std::int64_t ns = 0;
+    for(auto _ : state) {
+      histogram.record(quantity<nanosecond, std::int64_t>(ns));
+      ns = (ns + 997) & 0xFFFFF;
+    }
+  }
+  BENCHMARK(latency_histogram_record)->ThreadRange(1, 8);
+
+  void steady_clock_scoped_timer(benchmark::State& state)
+  {
+    latency_histogram<> h;
+    for(auto _ : state) {
+      scoped_timer timer([&](quantity<nanosecond, std::int64_t> t) { h.record(t); });
+    }
+  }
+  BENCHMARK(steady_clock_scoped_timer);
+
+#ifdef UNITS_HAS_TSC_CLOCK
+
+  void tsc_clock_scoped_timer(benchmark::State& state)
+  {
+    tsc_clock::calibrate();
+    latency_histogram<> h;
+    auto record = [&](quantity<nanosecond, std::int64_t> t) { h.record(t); };
+    for(auto _ : state) {
+      scoped_timer<decltype(record), tsc_clock> timer(record);
+    }
+  }
+  BENCHMARK(tsc_clock_scoped_timer);
+
+#endif
+
+}  // namespace
+
+BENCHMARK_MAIN();
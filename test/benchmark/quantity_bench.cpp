@@ -0,0 +1,292 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/dimensions/area.h>
+#include <units/dimensions/length.h>
+#include <units/dimensions/time.h>
+#include <units/dimensions/velocity.h>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Zero-overhead check of `quantity`
+//
+// Every kernel is benchmarked twice, on plain numbers (`raw_*`) and on quantities (`quantity_*`), for
+// a floating-point and an integral representation. After the run each `quantity_*` benchmark is
+// compared with its `raw_*` pair and the program fails if it is slower by more than the tolerance
+// given with `--max_overhead=<fraction>` (5% by default). The number of rounds of measurements is set
+// with `--rounds=<n>`.
+//
+// Build with `NDEBUG` - otherwise the precondition checks of the division operators are compiled in -
+// and with loops aligned to cache lines (see CMakeLists.txt).
+
+using namespace units;
+
+namespace {
+
+  constexpr std::size_t size = 1024;
+
+  // The arrays of a kernel have the same alignment and relative offsets for raw numbers and for
+  // quantities, and are not a multiple of 4 KiB apart (which makes loads and stores alias in the CPU),
+  // so that the memory layout does not favour either of them
+  template<typename Out, typename In1, typename In2 = In1>
+  struct buffers {
+    alignas(4096) In1 a[size];
+    std::byte pad1[192];
+    In2 b[size];
+    std::byte pad2[192];
+    Out out[size];
+
+    buffers()
+    {
+      for(std::size_t i = 0; i < size; ++i) {
+        const auto v = static_cast<std::int64_t>((i * 37) % 1000);
+        a[i] = In1(1 + v);
+        b[i] = In2(500 + v);
+      }
+    }
+  };
+
+  template<typename Out, typename In1, typename In2, typename Op>
+  void binary_kernel(benchmark::State& state, Op op)
+  {
+    static buffers<Out, In1, In2> buf;
+    for(auto _ : state) {
+      for(std::size_t i = 0; i < size; ++i) buf.out[i] = op(buf.a[i], buf.b[i]);
+      benchmark::DoNotOptimize(buf.out);
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(size));
+  }
+
+  // add
+
+  template<typename T>
+  void raw_add(benchmark::State& state)
+  {
+    binary_kernel<T, T, T>(state, [](T a, T b) { return a + b; });
+  }
+
+  template<typename T>
+  void quantity_add(benchmark::State& state)
+  {
+    using length = quantity<metre, T>;
+    binary_kernel<length, length, length>(state, [](length a, length b) { return a + b; });
+  }
+
+  // multiply
+
+  template<typename T>
+  void raw_multiply(benchmark::State& state)
+  {
+    binary_kernel<T, T, T>(state, [](T a, T b) { return a * b; });
+  }
+
+  template<typename T>
+  void quantity_multiply(benchmark::State& state)
+  {
+    using length = quantity<metre, T>;
+    binary_kernel<quantity<square_metre, T>, length, length>(state, [](length a, length b) { return a * b; });
+  }
+
+  // divide
+
+  template<typename T>
+  void raw_divide(benchmark::State& state)
+  {
+    binary_kernel<T, T, T>(state, [](T a, T b) { return a / b; });
+  }
+
+  template<typename T>
+  void quantity_divide(benchmark::State& state)
+  {
+    using length = quantity<metre, T>;
+    using time = quantity<second, T>;
+    binary_kernel<quantity<metre_per_second, T>, length, time>(state, [](length a, time b) { return a / b; });
+  }
+
+  // cast
+
+  template<typename T>
+  void raw_cast(benchmark::State& state)
+  {
+    binary_kernel<T, T, T>(state, [](T a, T) { return a * T(1000); });
+  }
+
+  template<typename T>
+  void quantity_cast_km_to_m(benchmark::State& state)
+  {
+    using km = quantity<kilometre, T>;
+    binary_kernel<quantity<metre, T>, km, km>(state, [](km a, km) { return quantity_cast<metre>(a); });
+  }
+
+  // compare
+
+  template<typename T>
+  void raw_compare(benchmark::State& state)
+  {
+    binary_kernel<std::int8_t, T, T>(state, [](T a, T b) { return std::int8_t(a < b); });
+  }
+
+  template<typename T>
+  void quantity_compare(benchmark::State& state)
+  {
+    using length = quantity<metre, T>;
+    binary_kernel<std::int8_t, length, length>(state, [](length a, length b) { return std::int8_t(a < b); });
+  }
+
+  // reduce
+
+  template<typename Acc, typename In>
+  void reduce_kernel(benchmark::State& state)
+  {
+    static buffers<In, In> buf;
+    for(auto _ : state) {
+      Acc sum = Acc::zero();
+      for(const auto& v : buf.a) sum += v;
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(size));
+  }
+
+  template<typename T>
+  struct raw_accumulator {
+    T value;
+    static raw_accumulator zero() { return {T(0)}; }
+    raw_accumulator& operator+=(T v) { value += v; return *this; }
+  };
+
+  template<typename T>
+  void raw_reduce(benchmark::State& state)
+  {
+    reduce_kernel<raw_accumulator<T>, T>(state);
+  }
+
+  template<typename T>
+  void quantity_reduce(benchmark::State& state)
+  {
+    using length = quantity<metre, T>;
+    reduce_kernel<length, length>(state);
+  }
+
+  using benchmark_fn = void (*)(benchmark::State&);
+
+  struct kernel {
+    std::string name;
+    benchmark_fn raw;
+    benchmark_fn qty;
+  };
+
+  template<typename T>
+  void add_kernels(std::vector<kernel>& kernels, const std::string& rep)
+  {
+    kernels.push_back({"add" + rep, raw_add<T>, quantity_add<T>});
+    kernels.push_back({"multiply" + rep, raw_multiply<T>, quantity_multiply<T>});
+    kernels.push_back({"divide" + rep, raw_divide<T>, quantity_divide<T>});
+    kernels.push_back({"cast" + rep, raw_cast<T>, quantity_cast_km_to_m<T>});
+    kernels.push_back({"compare" + rep, raw_compare<T>, quantity_compare<T>});
+    kernels.push_back({"reduce" + rep, raw_reduce<T>, quantity_reduce<T>});
+  }
+
+  // Prints the usual console output and keeps the times of every benchmark in the order of the runs
+  class overhead_reporter : public benchmark::ConsoleReporter {
+    std::map<std::string, std::vector<double>> times_;
+
+  public:
+    void ReportRuns(const std::vector<Run>& reports) override
+    {
+      ConsoleReporter::ReportRuns(reports);
+      for(const Run& run : reports)
+        if(run.run_type == Run::RT_Iteration && !run.error_occurred)
+          times_[run.run_name.function_name].push_back(run.GetAdjustedCPUTime());
+    }
+
+    // Compares the kernels of every round that was run (a `--benchmark_filter` may have skipped some)
+    [[nodiscard]] bool check(const std::vector<kernel>& kernels, double max_overhead) const
+    {
+      bool ok = true;
+      for(const kernel& k : kernels) {
+        const auto r = times_.find("raw_" + k.name);
+        const auto q = times_.find("quantity_" + k.name);
+        if(r == times_.end() || q == times_.end()) continue;
+        std::vector<double> ratios;
+        for(std::size_t i = 0; i < std::min(r->second.size(), q->second.size()); ++i)
+          ratios.push_back(q->second[i] / r->second[i]);
+        const auto median = ratios.begin() + static_cast<std::ptrdiff_t>(ratios.size() / 2);
+        std::nth_element(ratios.begin(), median, ratios.end());
+        const double overhead = *median - 1;
+        const bool pass = overhead <= max_overhead;
+        std::cout << (pass ? "ok     " : "FAILED ") << k.name << ": " << overhead * 100 << "%\n";
+        ok = ok && pass;
+      }
+      return ok;
+    }
+  };
+
+}  // namespace
+
+int main(int argc, char** argv)
+{
+  benchmark::Initialize(&argc, argv);
+
+  double max_overhead = 0.05;
+  int rounds = 15;
+  constexpr std::string_view overhead_flag = "--max_overhead=";
+  constexpr std::string_view rounds_flag = "--rounds=";
+  int remaining = 1;
+  for(int i = 1; i < argc; ++i) {
+    const std::string_view arg = argv[i];
+    if(arg.starts_with(overhead_flag))
+      max_overhead = std::strtod(argv[i] + overhead_flag.size(), nullptr);
+    else if(arg.starts_with(rounds_flag))
+      rounds = std::max(1, std::atoi(argv[i] + rounds_flag.size()));
+    else
+      argv[remaining++] = argv[i];
+  }
+  argc = remaining;
+  if(benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+
+  std::vector<kernel> kernels;
+  add_kernels<double>(kernels, "<double>");
+  add_kernels<std::int64_t>(kernels, "<std::int64_t>");
+
+  // The raw and the quantity version of a kernel run right after each other, and all the kernels are
+  // run in several rounds. The median of the per-round ratios does not depend on the load of the
+  // machine changing during the run, which a comparison of separately repeated benchmarks does.
+  for(int round = 0; round < rounds; ++round) {
+    for(const kernel& k : kernels) {
+      benchmark::RegisterBenchmark(("raw_" + k.name).c_str(), k.raw)->MinTime(0.02);
+      benchmark::RegisterBenchmark(("quantity_" + k.name).c_str(), k.qty)->MinTime(0.02);
+    }
+  }
+
+  overhead_reporter reporter;
+  benchmark::RunSpecifiedBenchmarks(&reporter);
+  return reporter.check(kernels, max_overhead) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,54 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/sharded_accumulator.h>
+#include <units/dimensions/length.h>
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdint>
+
+using namespace units;
+
+namespace {
+
+  using metres = quantity<metre, std::int64_t>;
+
+  std::atomic<std::int64_t> atomic_counter;
+  sharded_accumulator<metres> sharded_counter;
+
+  void atomic_fetch_add(benchmark::State& state)
+  {
+    for(auto _ : state) atomic_counter.fetch_add(1, std::memory_order_relaxed);
+    state.SetItemsProcessed(state.iterations());
+  }
+  BENCHMARK(atomic_fetch_add)->ThreadRange(1, 64)->UseRealTime();
+
+  void sharded_accumulator_add(benchmark::State& state)
+  {
+    for(auto _ : state) sharded_counter.add(metres(1));
+    state.SetItemsProcessed(state.iterations());
+  }
+  BENCHMARK(sharded_accumulator_add)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,117 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/transcendental.h>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <vector>
+
+using namespace units;
+
+namespace {
+
+  constexpr std::size_t size = 1 << 16;
+
+  template<typename T>
+  std::vector<T> angles(double step)
+  {
+    std::vector<T> v;
+    v.reserve(size);
+    for(std::size_t i = 0; i < size; ++i) v.emplace_back(static_cast<double>(i) * step);
+    return v;
+  }
+
+  void raw_std_sin(benchmark::State& state)
+  {
+    const auto in = angles<double>(0.001);
+    std::vector<double> out(size);
+    for(auto _ : state) {
+      for(std::size_t i = 0; i < size; ++i) out[i] = std::sin(in[i]);
+      benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(size));
+  }
+  BENCHMARK(raw_std_sin);
+
+  void raw_kernel_sin(benchmark::State& state)
+  {
+    const auto in = angles<double>(0.001);
+    std::vector<double> out(size);
+    for(auto _ : state) {
+      for(std::size_t i = 0; i < size; ++i) out[i] = detail::sincos_kernel<ratio<1>, false>(in[i]);
+      benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(size));
+  }
+  BENCHMARK(raw_kernel_sin);
+
+  void quantity_sin_radian(benchmark::State& state)
+  {
+    const auto in = angles<quantity<radian>>(0.001);
+    std::vector<double> out(size);
+    for(auto _ : state) {
+      units::sin(in, out);
+      benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(size));
+  }
+  BENCHMARK(quantity_sin_radian);
+
+  void quantity_sin_degree(benchmark::State& state)
+  {
+    const auto in = angles<quantity<degree>>(0.0573);
+    std::vector<double> out(size);
+    for(auto _ : state) {
+      units::sin(in, out);
+      benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(size));
+  }
+  BENCHMARK(quantity_sin_degree);
+
+  void raw_std_exp(benchmark::State& state)
+  {
+    const auto in = angles<double>(0.001);
+    std::vector<double> out(size);
+    for(auto _ : state) {
+      for(std::size_t i = 0; i < size; ++i) out[i] = std::exp(in[i]);
+      benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(size));
+  }
+  BENCHMARK(raw_std_exp);
+
+  void quantity_exponential_percent(benchmark::State& state)
+  {
+    const auto in = angles<quantity<percent>>(0.1);
+    std::vector<double> out(size);
+    for(auto _ : state) {
+      units::exponential(in, out);
+      benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<benchmark::IterationCount>(size));
+  }
+  BENCHMARK(quantity_exponential_percent);
+
+}  // namespace
+
+BENCHMARK_MAIN();
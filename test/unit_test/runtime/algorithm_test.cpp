@@ -0,0 +1,118 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/algorithm.h>
+#include <units/dimensions/area.h>
+#include <units/dimensions/energy.h>
+#include <units/dimensions/force.h>
+#include <units/dimensions/frequency.h>
+#include <units/dimensions/length.h>
+#include <units/dimensions/time.h>
+#include <units/dimensions/velocity.h>
+#include <units/integration.h>
+#include <units/lookup_table.h>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <execution>
+#include <vector>
+
+using namespace units;
+
+namespace {
+
+  template<typename Policy>
+  void check_algorithms(Policy policy)
+  {
+    std::vector<quantity<metre>> distances;
+    std::vector<quantity<newton>> forces;
+    std::vector<quantity<second>> times;
+    for(int i = 1; i <= 1000; ++i) {
+      distances.emplace_back(i);
+      forces.emplace_back(2);
+      times.emplace_back(0.5);
+    }
+
+    const quantity<metre> total = units::reduce(policy, distances);
+    CHECK(total.count() == 500500);
+
+    const quantity<joule> work = units::transform_reduce(policy, distances, forces);
+    CHECK(work.count() == 1001000);
+
+    const quantity<square_metre> sum_sq = units::transform_reduce(policy, distances, [](const quantity<metre>& d) { return d * d; });
+    CHECK(sum_sq.count() == 333833500);
+
+    std::vector<quantity<metre_per_second>> speeds(distances.size());
+    units::transform(policy, distances, times, speeds, [](const quantity<metre>& d, const quantity<second>& t) { return d / t; });
+    CHECK(speeds.front().count() == 2);
+    CHECK(speeds.back().count() == 2000);
+
+    std::vector<quantity<kilometre>> km(distances.size());
+    units::transform(policy, distances, km, [](const quantity<metre>& d) { return d; });
+    CHECK(km[499].count() == 0.5);
+  }
+
+}  // namespace
+
+TEST_CASE("algorithms with sequenced policy", "[algorithm]") { check_algorithms(std::execution::seq); }
+TEST_CASE("algorithms with unsequenced policy", "[algorithm]") { check_algorithms(std::execution::unseq); }
+
+TEST_CASE("algorithms with parallel policy", "[algorithm]") { check_algorithms(std::execution::par); }
+TEST_CASE("algorithms with parallel unsequenced policy", "[algorithm]") { check_algorithms(std::execution::par_unseq); }
+
+TEST_CASE("algorithms convert units and scales", "[algorithm]")
+{
+  const std::vector<quantity<millimetre, std::int64_t>> a{quantity<millimetre, std::int64_t>(1000),
+                                                          quantity<millimetre, std::int64_t>(2000)};
+  const std::vector<quantity<kilometre, std::int64_t>> b{quantity<kilometre, std::int64_t>(1),
+                                                         quantity<kilometre, std::int64_t>(1)};
+  // mm * km = m²
+  const quantity<square_metre, std::int64_t> area = units::transform_reduce(std::execution::seq, a, b);
+  CHECK(area.count() == 3000);
+
+  // a dimensionless result takes the unit ratios into account
+  const std::vector<quantity<second, std::int64_t>> t{quantity<second, std::int64_t>(2),
+                                                      quantity<second, std::int64_t>(3)};
+  const std::vector<quantity<hertz, std::int64_t>> f{quantity<hertz, std::int64_t>(5),
+                                                     quantity<hertz, std::int64_t>(10)};
+  CHECK(units::transform_reduce(std::execution::seq, t, f) == 40);
+
+  // ms * Hz has the fractional ratio 1/1000
+  const std::vector<quantity<millisecond, std::int64_t>> t_ms{quantity<millisecond, std::int64_t>(1000),
+                                                              quantity<millisecond, std::int64_t>(2000)};
+  CHECK(units::transform_reduce(std::execution::seq, t_ms, f) == 25);
+}
+
+TEST_CASE("algorithms work together with integration and lookup tables", "[algorithm]")
+{
+  const std::vector<quantity<second>> t{quantity<second>(0), quantity<second>(1), quantity<second>(2)};
+  const std::vector<quantity<metre_per_second>> v{quantity<metre_per_second>(0), quantity<metre_per_second>(2),
+                                                  quantity<metre_per_second>(4)};
+
+  const lookup_table speed(t, v);
+  std::vector<quantity<metre_per_second>> samples(5);
+  const std::vector<quantity<second>> at{quantity<second>(0), quantity<second>(0.5), quantity<second>(1),
+                                         quantity<second>(1.5), quantity<second>(2)};
+  units::transform(std::execution::seq, at, samples, [&](const quantity<second>& x) { return speed(x); });
+
+  CHECK(units::trapezoid(samples, quantity<second>(0.5)).count() == Approx(4));
+  CHECK(units::reduce(std::execution::seq, samples).count() == Approx(10));
+}
@@ -0,0 +1,129 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/any_quantity.h>
+#include <units/dimensions/energy.h>
+#include <units/dimensions/power.h>
+#include <units/dimensions/velocity.h>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <type_traits>
+
+using namespace units;
+
+static_assert(sizeof(any_quantity) <= 24);
+static_assert(std::is_trivially_copyable_v<any_quantity>);
+static_assert(std::is_convertible_v<quantity<kilometre, int>, any_quantity>);
+
+TEST_CASE("any_quantity is implicitly constructible from quantity", "[any_quantity]")
+{
+  const any_quantity q = 2km;
+
+  CHECK(q.count() == 2);
+  CHECK(q.coherent_count() == 2000);
+  CHECK(q.scale() == 1000);
+  CHECK(q.dimension() == dimension_code_of<length>);
+  CHECK(q.has_dimension<length>());
+  CHECK(!q.has_dimension<units::time>());
+}
+
+TEST_CASE("any_quantity_cast converts to the requested unit", "[any_quantity][cast]")
+{
+  SECTION("same unit")
+  {
+    CHECK(any_quantity_cast<quantity<metre, std::int64_t>>(123m) == 123m);
+  }
+
+  SECTION("different unit of the same dimension")
+  {
+    const any_quantity q = 2km;
+    CHECK(any_quantity_cast<quantity<metre, std::int64_t>>(q).count() == 2000);
+    CHECK(any_quantity_cast<quantity<centimetre, double>>(q).count() == 200000);
+  }
+
+  SECTION("derived dimension")
+  {
+    const any_quantity q = quantity<kilometre_per_hour, double>(36);
+    CHECK(any_quantity_cast<quantity<metre_per_second>>(q).count() == Approx(10));
+  }
+
+  SECTION("integral representation is rounded to the nearest value")
+  {
+    CHECK(any_quantity_cast<quantity<millimetre, int>>(quantity<millimetre, int>(4007)).count() == 4007);
+    CHECK(any_quantity_cast<quantity<millimetre, int>>(quantity<millimetre, int>(-4007)).count() == -4007);
+    CHECK(any_quantity_cast<quantity<metre, int>>(quantity<millimetre, int>(4499)).count() == 4);
+    CHECK(any_quantity_cast<quantity<metre, int>>(quantity<millimetre, int>(4500)).count() == 5);
+    CHECK(any_quantity_cast<quantity<metre, int>>(quantity<millimetre, int>(-4500)).count() == -5);
+  }
+
+  SECTION("dimension mismatch")
+  {
+    const any_quantity q = 2km;
+    REQUIRE_THROWS_AS(any_quantity_cast<quantity<second>>(q), bad_any_quantity_cast);
+  }
+}
+
+TEST_CASE("any_quantity round trip of integral representations", "[any_quantity][cast]")
+{
+  SECTION("millimetre, int")
+  {
+    for(int i = -100'000; i <= 100'000; ++i) {
+      const quantity<millimetre, int> q(i);
+      REQUIRE(any_quantity_cast<quantity<millimetre, int>>(q) == q);
+    }
+  }
+
+  SECTION("nanosecond, long")
+  {
+    for(long i = 0; i < 200'000; ++i) {
+      const quantity<nanosecond, long> q(i * 1'000'003);
+      REQUIRE(any_quantity_cast<quantity<nanosecond, long>>(q) == q);
+    }
+  }
+
+  SECTION("kilometre to millimetre")
+  {
+    for(int i = -1000; i <= 1000; ++i)
+      REQUIRE(any_quantity_cast<quantity<millimetre, std::int64_t>>(quantity<kilometre, int>(i)).count() == i * 1'000'000);
+  }
+}
+
+TEST_CASE("any_quantity multiplication and division compute runtime dimensions", "[any_quantity][arithmetic]")
+{
+  const any_quantity e = 3kJ;
+  const any_quantity t = 2s;
+
+  const any_quantity p = e / t;
+  CHECK(p.dimension() == dimension_code_of<power>);
+  CHECK(any_quantity_cast<quantity<watt, double>>(p).count() == Approx(1500));
+
+  const any_quantity back = p * t;
+  CHECK(back.has_dimension<energy>());
+  CHECK(any_quantity_cast<quantity<joule, double>>(back).count() == Approx(3000));
+}
+
+TEST_CASE("any_quantity comparison", "[any_quantity][compare]")
+{
+  CHECK(any_quantity(1km) == any_quantity(1000m));
+  CHECK(any_quantity(1km) != any_quantity(1m));
+  CHECK(any_quantity(1s) != any_quantity(1m));
+}
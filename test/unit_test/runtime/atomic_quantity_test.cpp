@@ -0,0 +1,116 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/atomic_quantity.h>
+#include <units/dimensions/energy.h>
+#include <units/dimensions/length.h>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace units;
+
+namespace {
+
+  template<typename A, typename Q>
+  concept can_fetch_add = requires(A& a, Q q) { a.fetch_add(q, std::memory_order_relaxed); };
+
+  static_assert(sizeof(atomic_quantity<metre, std::int64_t>) == sizeof(std::atomic<std::int64_t>));
+  static_assert(atomic_quantity<metre, std::int64_t>::is_always_lock_free ==
+                std::atomic<std::int64_t>::is_always_lock_free);
+
+  static_assert(can_fetch_add<atomic_quantity<millimetre, std::int64_t>, quantity<kilometre, std::int64_t>>);
+  static_assert(can_fetch_add<atomic_quantity<metre, double>, quantity<millimetre, double>>);
+  static_assert(!can_fetch_add<atomic_quantity<kilometre, std::int64_t>, quantity<metre, std::int64_t>>);  // truncating
+  static_assert(!can_fetch_add<atomic_quantity<metre, std::int64_t>, quantity<metre, double>>);            // truncating
+  static_assert(!can_fetch_add<atomic_quantity<metre, double>, quantity<joule, double>>);                  // dimension
+
+}  // namespace
+
+TEST_CASE("atomic_quantity load/store/exchange", "[atomic_quantity]")
+{
+  atomic_quantity<metre, std::int64_t> a(quantity<metre, std::int64_t>(3));
+  CHECK(a.load(std::memory_order_relaxed) == quantity<metre, std::int64_t>(3));
+
+  a.store(quantity<metre, std::int64_t>(5), std::memory_order_release);
+  CHECK(a.load(std::memory_order_acquire).count() == 5);
+
+  CHECK(a.exchange(quantity<metre, std::int64_t>(7), std::memory_order_acq_rel).count() == 5);
+  CHECK(a.load(std::memory_order_relaxed).count() == 7);
+}
+
+TEST_CASE("atomic_quantity compare_exchange", "[atomic_quantity]")
+{
+  atomic_quantity<joule, double> a(quantity<joule, double>(1.0));
+
+  auto expected = quantity<joule, double>(2.0);
+  CHECK_FALSE(a.compare_exchange_strong(expected, quantity<joule, double>(3.0), std::memory_order_acq_rel,
+                                        std::memory_order_acquire));
+  CHECK(expected.count() == 1.0);
+
+  CHECK(a.compare_exchange_strong(expected, quantity<joule, double>(3.0), std::memory_order_acq_rel,
+                                  std::memory_order_acquire));
+  CHECK(a.load(std::memory_order_relaxed).count() == 3.0);
+
+  expected = quantity<joule, double>(3.0);
+  while(!a.compare_exchange_weak(expected, quantity<joule, double>(4.0), std::memory_order_acq_rel,
+                                 std::memory_order_acquire)) {
+  }
+  CHECK(a.load(std::memory_order_relaxed).count() == 4.0);
+}
+
+TEST_CASE("atomic_quantity fetch_add/fetch_sub convert units", "[atomic_quantity]")
+{
+  atomic_quantity<millimetre, std::int64_t> a;
+  CHECK(a.fetch_add(quantity<metre, std::int64_t>(2), std::memory_order_relaxed).count() == 0);
+  CHECK(a.fetch_add(quantity<millimetre, std::int64_t>(5), std::memory_order_relaxed).count() == 2000);
+  CHECK(a.fetch_sub(quantity<centimetre, std::int64_t>(1), std::memory_order_relaxed).count() == 2005);
+  CHECK(a.load(std::memory_order_relaxed).count() == 1995);
+
+  atomic_quantity<kilojoule, double> e;
+  e.fetch_add(quantity<joule, double>(500), std::memory_order_relaxed);
+  e.fetch_sub(quantity<kilojoule, double>(2), std::memory_order_relaxed);
+  CHECK(e.load(std::memory_order_relaxed).count() == Approx(-1.5));
+}
+
+TEST_CASE("atomic_quantity concurrent fetch_add", "[atomic_quantity]")
+{
+  constexpr int threads = 4;
+  constexpr int iterations = 10000;
+
+  atomic_quantity<millimetre, std::int64_t> length;
+  atomic_quantity<joule, double> energy;
+
+  std::vector<std::thread> workers;
+  for(int t = 0; t < threads; ++t)
+    workers.emplace_back([&] {
+      for(int i = 0; i < iterations; ++i) {
+        length.fetch_add(quantity<metre, std::int64_t>(1), std::memory_order_relaxed);
+        energy.fetch_add(quantity<joule, double>(0.5), std::memory_order_relaxed);
+      }
+    });
+  for(auto& w : workers) w.join();
+
+  CHECK(length.load(std::memory_order_relaxed).count() == threads * iterations * 1000);
+  CHECK(energy.load(std::memory_order_relaxed).count() == threads * iterations * 0.5);
+}
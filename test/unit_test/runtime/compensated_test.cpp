@@ -0,0 +1,112 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/compensated.h>
+#include <units/dimensions/energy.h>
+#include <units/dimensions/length.h>
+#include <units/dimensions/power.h>
+#include <units/dimensions/time.h>
+#include <catch2/catch.hpp>
+#include <vector>
+
+using namespace units;
+
+namespace {
+
+  using cdouble = compensated<double>;
+
+  static_assert(Scalar<cdouble>);
+  static_assert(treat_as_floating_point<cdouble>);
+  static_assert(std::is_same_v<std::common_type_t<cdouble, std::intmax_t>, cdouble>);
+
+  template<typename A, typename Q>
+  concept can_add = requires(A& a, Q q) { a.add(q); };
+
+  static_assert(can_add<compensated_sum<quantity<joule>>, quantity<kilojoule>>);
+  static_assert(!can_add<compensated_sum<quantity<kilojoule>>, quantity<joule>>);
+  static_assert(!can_add<compensated_sum<quantity<joule>>, quantity<metre>>);
+
+}  // namespace
+
+TEST_CASE("compensated addition does not drift", "[compensated]")
+{
+  cdouble sum = 1e8;
+  double naive = 1e8;
+  for(int i = 0; i < 1'000'000; ++i) {
+    sum += 0.1;
+    naive += 0.1;
+  }
+  CHECK(sum.value() == 1e8 + 1e5);
+  CHECK(naive != 1e8 + 1e5);
+}
+
+TEST_CASE("compensated arithmetic", "[compensated]")
+{
+  const cdouble a = 3;
+  const cdouble b = 4;
+  CHECK((a + b).value() == 7);
+  CHECK((a - b).value() == -1);
+  CHECK((a * b).value() == 12);
+  CHECK((b / a).value() == Approx(4. / 3));
+  CHECK(-a < a);
+  CHECK(a == cdouble(3));
+
+  // the remainder of 1/3 is kept in the low part
+  const cdouble third = cdouble(1) / cdouble(3);
+  CHECK((third * cdouble(3)).value() == 1);
+}
+
+TEST_CASE("quantity with compensated representation", "[compensated]")
+{
+  quantity<kilowatt, cdouble> power(cdouble(1e6));
+  for(int i = 0; i < 100'000; ++i) power += quantity<kilowatt, cdouble>(cdouble(0.001));
+  CHECK(power.count().value() == 1e6 + 100);
+
+  const quantity<watt, cdouble> w = power;
+  CHECK(w.count().value() == 1e9 + 1e5);
+
+  const auto e = power * quantity<hour, cdouble>(cdouble(2));
+  CHECK(quantity_cast<quantity<kilojoule, double>>(e).count() == Approx((1e6 + 100) * 2 * 3600));
+}
+
+TEST_CASE("compensated_sum accumulates quantities", "[compensated]")
+{
+  compensated_sum<quantity<joule>> sum;
+  sum.add(quantity<kilojoule>(1e5));
+  for(int i = 0; i < 1'000'000; ++i) sum.add(quantity<joule>(0.1));
+  CHECK(sum.value().count() == 1e8 + 1e5);
+
+  compensated_sum<quantity<joule>> other;
+  other.add(quantity<joule>(0.1));
+  sum.merge(other);
+  CHECK(sum.value().count() == 1e8 + 1e5 + 0.1);
+}
+
+TEST_CASE("compensated_sum batch update", "[compensated]")
+{
+  std::vector<quantity<joule>> xs(1'000'003, quantity<joule>(0.1));
+  xs[0] = quantity<joule>(1e8);
+
+  compensated_sum<quantity<joule>> batch;
+  batch.add(xs);
+  CHECK(batch.value().count() == Approx(1e8 + 100'000.2).epsilon(1e-15));
+}
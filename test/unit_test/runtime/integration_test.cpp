@@ -0,0 +1,120 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/dimensions/energy.h>
+#include <units/dimensions/length.h>
+#include <units/dimensions/power.h>
+#include <units/dimensions/time.h>
+#include <units/dimensions/velocity.h>
+#include <units/integration.h>
+#include <catch2/catch.hpp>
+#include <array>
+#include <vector>
+
+using namespace units;
+
+namespace {
+
+  using s = quantity<second>;
+  using W = quantity<watt>;
+  using m = quantity<metre>;
+
+  static_assert(std::is_same_v<decltype(trapezoid(std::vector<W>(), s(1))), quantity<joule>>);
+  static_assert(std::is_same_v<decltype(trapezoid(std::vector<quantity<kilowatt>>(), quantity<hour>(1)))::dimension, energy>);
+  static_assert(std::is_same_v<decltype(simpson(std::vector<quantity<watt, int>>(), quantity<second, int>(1))), quantity<joule>>);
+  static_assert(std::is_same_v<detail::derivative_quantity<m, s>, quantity<metre_per_second>>);
+  static_assert(std::is_same_v<detail::derivative_quantity<quantity<kilometre>, quantity<hour>>, quantity<kilometre_per_hour>>);
+  static_assert(std::is_same_v<detail::derivative_quantity<m, m>::dimension, dimension_divide<length, length>>);
+
+  constexpr std::array<W, 5> ramp = {W(0), W(1), W(2), W(3), W(4)};
+  static_assert(trapezoid(ramp, s(2)) == quantity<joule>(16));
+  static_assert(simpson(ramp, s(2)) == quantity<joule>(16));
+
+  // y = 3 t^2 sampled with the step dt on [0, 2]
+  std::vector<W> cubic_integrand(std::size_t intervals)
+  {
+    std::vector<W> y;
+    const double dt = 2. / static_cast<double>(intervals);
+    for(std::size_t i = 0; i <= intervals; ++i) {
+      const double t = static_cast<double>(i) * dt;
+      y.emplace_back(3 * t * t);
+    }
+    return y;
+  }
+
+}  // namespace
+
+TEST_CASE("trapezoid integrates uniformly spaced samples", "[integration]")
+{
+  const auto y = cubic_integrand(1000);
+  const quantity<joule> e = trapezoid(y, s(0.002));
+  CHECK(e.count() == Approx(8).epsilon(1e-5));
+  CHECK(trapezoid(std::vector<W>{W(5)}, s(1)).count() == 0);
+}
+
+TEST_CASE("trapezoid integrates non-uniformly spaced samples", "[integration]")
+{
+  const std::vector<s> t = {s(0), s(0.5), s(2), s(2.5), s(4)};
+  const std::vector<W> y = {W(1), W(1), W(3), W(3), W(1)};
+  CHECK(trapezoid(t, y) == quantity<joule>(0.5 + 3 + 1.5 + 3));
+}
+
+TEST_CASE("simpson is exact for cubic integrands", "[integration]")
+{
+  for(std::size_t intervals : {2, 3, 4, 5, 8, 9, 101}) {
+    const auto y = cubic_integrand(intervals);
+    CHECK(simpson(y, s(2. / static_cast<double>(intervals))).count() == Approx(8).epsilon(1e-12));
+  }
+  CHECK(simpson(std::vector<W>{W(2), W(4)}, s(1)) == quantity<joule>(3));
+}
+
+TEST_CASE("derivative of uniformly spaced samples", "[integration]")
+{
+  // x = t^2 + 1
+  std::vector<m> x;
+  for(int i = 0; i < 11; ++i) x.emplace_back(i * i * 0.01 + 1);
+  std::vector<quantity<metre_per_second>> v(x.size());
+  derivative(x, s(0.1), v);
+  CHECK(v[0].count() == Approx(0.1));
+  for(std::size_t i = 1; i + 1 < v.size(); ++i) CHECK(v[i].count() == Approx(0.2 * static_cast<double>(i)));
+  CHECK(v[10].count() == Approx(1.9));
+}
+
+TEST_CASE("derivative of non-uniformly spaced samples", "[integration]")
+{
+  const std::vector<s> t = {s(0), s(0.5), s(2), s(2.5), s(4)};
+  std::vector<m> x;
+  for(const auto& ti : t) x.emplace_back(ti.count() * ti.count());
+  std::vector<quantity<metre_per_second>> v(x.size());
+  derivative(t, x, v);
+  for(std::size_t i = 1; i + 1 < v.size(); ++i) CHECK(v[i].count() == Approx(2 * t[i].count()));
+}
+
+TEST_CASE("trapezoid_integrator accumulates a stream of samples", "[integration]")
+{
+  trapezoid_integrator<quantity<millisecond>, quantity<kilowatt>> energy;
+  CHECK(energy.value().count() == 0);
+  energy.add(quantity<millisecond>(0), quantity<kilowatt>(2));
+  energy.add(quantity<millisecond>(500), quantity<kilowatt>(4));
+  energy.add(quantity<millisecond>(1500), quantity<kilowatt>(4));
+  CHECK(quantity<joule>(energy.value()) == quantity<joule>(1500 + 4000));
+}
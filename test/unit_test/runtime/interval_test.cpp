@@ -0,0 +1,157 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/dimensions/length.h>
+#include <units/dimensions/time.h>
+#include <units/dimensions/velocity.h>
+#include <units/interval.h>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+using namespace units;
+
+namespace {
+
+  using I = interval<double>;
+
+  static_assert(Scalar<I>);
+  static_assert(treat_as_floating_point<I>);
+  static_assert(std::is_same_v<std::common_type_t<I, std::intmax_t>, I>);
+  static_assert(std::is_same_v<std::common_type_t<interval<float>, double>, I>);
+
+  // exact operations keep point intervals
+  static_assert(I(1.5) + I(2.25) == I(3.75));
+  static_assert(I(1.5) * I(-4) == I(-6));
+  static_assert(I(1, 2) - I(1, 2) == I(-1, 1));
+  static_assert(I(-1, 2) * I(3, 4) == I(-4, 8));
+  static_assert(I(-2, 3) * I(-5, 7) == I(-15, 21));
+  static_assert(I(-3, -2) * I(4, 5) == I(-15, -8));
+  static_assert(I(-3, -2) * I(-5, -4) == I(8, 15));
+  static_assert(I(1, 2) / I(-4, -2) == I(-1, -0.25));
+  static_assert(I(-1, 2) / I(4, 8) == I(-0.25, 0.5));
+
+  // inexact ones are rounded outwards, also at compile time
+  static_assert((I(1) / I(3)).lower() < 1. / 3 || (I(1) / I(3)).upper() > 1. / 3);
+  static_assert((I(1) / I(3)).upper() == detail::next_up((I(1) / I(3)).lower()));
+  static_assert((I(0.1) + I(0.2)).upper() == detail::next_up((I(0.1) + I(0.2)).lower()));
+  static_assert((I(1) / I(3) * I(3)).contains(1));
+
+  static_assert(I(1, 2) < I(3, 4));
+  static_assert(I(3, 4) > I(1, 2));
+  static_assert(!(I(1, 3) < I(2, 4)) && !(I(1, 3) > I(2, 4)) && !(I(1, 3) == I(2, 4)));
+
+  static_assert(quantity_cast<quantity<metre, I>>(quantity<kilometre, I>(I(1.5))).count() == I(1500));
+
+}  // namespace
+
+TEST_CASE("interval bounds contain the exact result", "[interval]")
+{
+  SECTION("addition")
+  {
+    const I sum = I(0.1) + I(0.2);
+    CHECK(sum.lower() < sum.upper());
+    CHECK(sum.contains(0.1 + 0.2));
+    CHECK(sum.upper() == detail::next_up(sum.lower()));
+  }
+
+  SECTION("run time and compile time agree")
+  {
+    volatile double a = 1;
+    volatile double b = 3;
+    constexpr I ct = I(1) / I(3);
+    CHECK(I(a) / I(b) == ct);
+    CHECK(I(b) * I(0.1) == I(3) * I(0.1));
+  }
+
+  SECTION("division by an interval containing zero")
+  {
+    CHECK(I(1) / I(-1, 1) == I::whole());
+    CHECK((I(1) / I(0)).lower() == -std::numeric_limits<double>::infinity());
+  }
+
+  SECTION("overflow")
+  {
+    const I big = I(std::numeric_limits<double>::max()) * I(2);
+    CHECK(big.lower() == std::numeric_limits<double>::max());
+    CHECK(big.upper() == std::numeric_limits<double>::infinity());
+  }
+
+  SECTION("conversion of integers that doubles cannot represent")
+  {
+    const std::int64_t v = (std::int64_t(1) << 53) + 1;
+    const I i(v);
+    CHECK(i.lower() == 9007199254740992.);
+    CHECK(i.upper() == 9007199254740994.);
+    CHECK(I(std::numeric_limits<std::int64_t>::max()).lower() < 9223372036854775807.);
+    CHECK(I(std::numeric_limits<std::int64_t>::max()).upper() == 9223372036854775808.);
+    CHECK(I(std::int64_t(42)) == I(42.));
+  }
+
+  SECTION("printing")
+  {
+    std::ostringstream os;
+    os << I(1, 2);
+    CHECK(os.str() == "[1, 2]");
+  }
+}
+
+TEST_CASE("interval quantities", "[interval]")
+{
+  using kmph = quantity<kilometre_per_hour, I>;
+  using mps = quantity<metre_per_second, I>;
+
+  SECTION("conversion with an inexact ratio")
+  {
+    // 36 km/h * 5/18, where 5/18 has no exact binary representation
+    const mps v = quantity_cast<mps>(kmph(I(36)));
+    CHECK(v.count().contains(10));
+    CHECK(v.count().width() < 1e-14);
+  }
+
+  SECTION("arithmetic")
+  {
+    const quantity<metre, I> d(I(100, 101));
+    const quantity<second, I> t(I(9.5, 10));
+    const auto v = d / t;
+    CHECK(v.count().lower() == Approx(10));
+    CHECK(v.count().upper() == Approx(101 / 9.5));
+    CHECK((d + quantity<kilometre, I>(I(1))).count() == I(1100, 1101));
+    CHECK(quantity<metre, I>(I(1, 2)) < quantity<metre, I>(I(3)));
+    CHECK(d / quantity<metre, I>(I(100)) == I(1, 1.01));
+  }
+
+  SECTION("bulk")
+  {
+    std::vector<quantity<kilometre_per_hour, I>> in;
+    for(int i = 0; i < 100; ++i) in.emplace_back(I(i * 3.7));
+    std::vector<mps> out(in.size());
+    for(std::size_t i = 0; i < in.size(); ++i) out[i] = quantity_cast<mps>(in[i]);
+    for(std::size_t i = 0; i < in.size(); ++i) {
+      const long double exact = static_cast<long double>(in[i].count().lower()) * 5 / 18;
+      CHECK(static_cast<long double>(out[i].count().lower()) <= exact);
+      CHECK(static_cast<long double>(out[i].count().upper()) >= exact);
+    }
+  }
+}
@@ -0,0 +1,91 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/dimensions/length.h>
+#include <units/dimensions/pressure.h>
+#include <units/dimensions/time.h>
+#include <units/lookup_table.h>
+#include <catch2/catch.hpp>
+#include <array>
+#include <vector>
+
+using namespace units;
+
+namespace {
+
+  struct kilopascal : prefixed_derived_unit<kilopascal, kilo, pascal> {};
+
+  using km = quantity<kilometre>;
+  using kPa = quantity<kilopascal>;
+
+  // standard atmosphere, pressure over altitude
+  const std::array<km, 6> altitude = {km(0), km(1), km(2), km(5), km(10), km(20)};
+  const std::array<kPa, 6> air_pressure = {kPa(101.325), kPa(89.876), kPa(79.501), kPa(54.048), kPa(26.5), kPa(5.529)};
+
+  using table = lookup_table<km, kPa>;
+  static_assert(std::is_same_v<decltype(lookup_table(altitude, air_pressure)), table>);
+  static_assert(std::is_same_v<table::slope_type::dimension, dimension_divide<pressure, length>>);
+  static_assert(std::is_same_v<lookup_table<quantity<metre, int>, quantity<second, int>>::rep, double>);
+
+}  // namespace
+
+TEST_CASE("lookup_table interpolates between breakpoints", "[lookup_table]")
+{
+  const table t(altitude, air_pressure);
+  CHECK(t.size() == 6);
+  for(std::size_t i = 0; i < altitude.size(); ++i) CHECK(t(altitude[i]).count() == Approx(air_pressure[i].count()));
+  CHECK(t(km(0.5)).count() == Approx((101.325 + 89.876) / 2));
+  CHECK(t(km(7.5)).count() == Approx((54.048 + 26.5) / 2));
+  CHECK(t.slope(0).count() == Approx(89.876 - 101.325));
+}
+
+TEST_CASE("lookup_table converts the argument to the unit of the breakpoints", "[lookup_table]")
+{
+  const table t(altitude, air_pressure);
+  CHECK(t(quantity<metre>(1500)).count() == Approx((89.876 + 79.501) / 2));
+  CHECK(t(quantity<metre, int>(10000)).count() == Approx(26.5));
+
+  const lookup_table<quantity<metre>, quantity<pascal>> in_metres(altitude, air_pressure);
+  CHECK(in_metres.breakpoint(1).count() == 1000);
+  CHECK(in_metres(quantity<metre>(1500)).count() == Approx((89876 + 79501) / 2.));
+}
+
+TEST_CASE("lookup_table clamps arguments outside the breakpoints", "[lookup_table]")
+{
+  const table t(altitude, air_pressure);
+  CHECK(t(km(-1)).count() == Approx(101.325));
+  CHECK(t(km(100)).count() == Approx(5.529));
+
+  const lookup_table<km, kPa> two(std::vector<km>{km(0), km(1)}, std::vector<kPa>{kPa(0), kPa(2)});
+  CHECK(two(km(0.25)).count() == Approx(0.5));
+  CHECK(two(km(2)).count() == Approx(2));
+}
+
+TEST_CASE("lookup_table batch lookup matches the scalar one", "[lookup_table]")
+{
+  const table t(altitude, air_pressure);
+  std::vector<quantity<metre>> in;
+  for(int i = -100; i < 1000; ++i) in.emplace_back(i * 23.5);
+  std::vector<kPa> out(in.size());
+  t(in, out);
+  for(std::size_t i = 0; i < in.size(); ++i) CHECK(out[i] == t(in[i]));
+}
@@ -22,6 +22,8 @@
 
 #include "units/math.h"
 #include "units/dimensions/area.h"
+#include "units/dimensions/energy.h"
+#include "units/dimensions/force.h"
 #include "units/dimensions/volume.h"
 #include <catch2/catch.hpp>
 
@@ -42,6 +44,31 @@ TEST_CASE("sqrt() on quantity changes the value and the dimension accordingly",
   REQUIRE(sqrt(4sq_m) == 2m);
 }
 
+TEST_CASE("cbrt() and rational pow<Num, Den>() on quantity", "[math][pow]")
+{
+  CHECK(cbrt(27.0cub_m) == 3.0m);
+  CHECK(pow<2, 3>(8.0cub_km) == 4.0sq_km);
+}
+
+TEST_CASE("fma() rounds once", "[math][fma]")
+{
+  // 0.1 * 10 - 1 is exactly 5.55e-17 with a single rounding and 0 when the product is rounded first
+  const auto r = fma(quantity<metre>(0.1), quantity<newton>(10.0), quantity<joule>(-1.0));
+  CHECK(r.count() == std::fma(0.1, 10.0, -1.0));
+  CHECK(r.count() != 0);
+
+  CHECK(fma(2.0km, 3.0N, 4.0_J) == 6004.0_J);
+}
+
+TEST_CASE("hypot() on quantities of the same dimension", "[math][hypot]")
+{
+  CHECK(hypot(3.0m, 4.0m) == 5.0m);
+  CHECK(hypot(3m, 4m) == quantity<metre, double>(5));
+  CHECK(hypot(300.0cm, 4.0m) == 500.0cm);
+  CHECK(hypot(2.0m, 3.0m, 6.0m) == 7.0m);
+  CHECK(hypot(200.0cm, 3.0m, 6000.0mm) == 7000.0mm);
+}
+
 // BDD style
 
 SCENARIO("quantities should work with pow<N>()", "[math][pow]")
@@ -0,0 +1,145 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/dimensions/acceleration.h>
+#include <units/dimensions/area.h>
+#include <units/dimensions/frequency.h>
+#include <units/dimensions/length.h>
+#include <units/dimensions/time.h>
+#include <units/dimensions/velocity.h>
+#include <units/matrix.h>
+#include <catch2/catch.hpp>
+
+using namespace units;
+
+namespace {
+
+  // state (position, velocity)
+  using state = unit_list<metre, metre_per_second>;
+  using inverse_state = unit_list<inverse_unit<metre>, inverse_unit<metre_per_second>>;
+  using covariance = matrix<state, state>;
+  using transition = matrix<state, inverse_state>;
+  using state_vector = matrix<state, unit_list<one>>;
+
+  static_assert(std::is_same_v<inverse_unit<second>, hertz>);
+  static_assert(std::is_same_v<covariance::element_type<0, 0>, quantity<square_metre>>);
+  static_assert(std::is_same_v<covariance::element_type<1, 1>::dimension, dimension_multiply<velocity, velocity>>);
+  static_assert(std::is_same_v<transition::element_type<0, 0>, quantity<one>>);
+  static_assert(std::is_same_v<transition::element_type<0, 1>, quantity<second>>);
+  static_assert(std::is_same_v<state_vector::element_type<1, 0>, quantity<metre_per_second>>);
+  static_assert(alignof(covariance) == 64);
+
+  // products are checked at compile time
+  template<typename A, typename B>
+  concept can_multiply = requires(A a, B b) { a * b; };
+  static_assert(can_multiply<transition, covariance>);
+  static_assert(can_multiply<transition, state_vector>);
+  static_assert(!can_multiply<covariance, covariance>);
+  static_assert(!can_multiply<state_vector, transition>);
+  static_assert(std::is_same_v<decltype(transition() * state_vector()), state_vector>);
+  static_assert(std::is_same_v<decltype(transition() * covariance() * transpose(transition())), covariance>);
+
+  template<typename M>
+  concept has_identity = requires { M::identity(); };
+  static_assert(has_identity<transition>);
+  static_assert(!has_identity<covariance>);
+
+  constexpr transition constant_velocity(quantity<second> dt)
+  {
+    auto f = transition::identity();
+    f.set<0, 1>(dt);
+    return f;
+  }
+
+  static_assert(constant_velocity(quantity<second>(2)).get<0, 1>() == quantity<second>(2));
+  static_assert((constant_velocity(quantity<second>(2)) * state_vector(10.m, 3.mps)).get<0, 0>() == 16.m);
+
+}  // namespace
+
+TEST_CASE("matrix construction and element access", "[matrix]")
+{
+  const covariance p(1.sq_m, 2.m * 1.mps, 2.m * 1.mps, quantity<unit<dimension_multiply<velocity, velocity>, ratio<1>>>(4));
+  CHECK(p.get<0, 0>() == 1.sq_m);
+  CHECK(p.get<0, 1>().count() == 2);
+  CHECK(p.get<1, 1>().count() == 4);
+  CHECK(transpose(p) == p);
+
+  covariance q = p + p;
+  CHECK(q.get<0, 0>() == 2.sq_m);
+  q -= p;
+  CHECK(q == p);
+  CHECK((2. * p).get<1, 1>().count() == 8);
+}
+
+TEST_CASE("Kalman covariance prediction", "[matrix]")
+{
+  const transition f = constant_velocity(quantity<second>(0.5));
+  covariance p;
+  p.set<0, 0>(4.sq_m);
+  p.set<1, 1>(1.mps * 1.mps);
+
+  // P' = F P F^T
+  const covariance predicted = f * p * transpose(f);
+  CHECK(predicted.get<0, 0>().count() == Approx(4.25));  // 4 + 0.5^2
+  CHECK(predicted.get<0, 1>().count() == Approx(0.5));
+  CHECK(predicted.get<1, 0>().count() == Approx(0.5));
+  CHECK(predicted.get<1, 1>().count() == Approx(1));
+}
+
+TEST_CASE("matrix inner units with different ratios are rescaled", "[matrix]")
+{
+  // (1x2 in metre and km) times (2x1 in 1/m), inner units m and km
+  using a_type = matrix<unit_list<one>, unit_list<metre, kilometre>>;
+  using b_type = matrix<unit_list<one, one>, unit_list<inverse_unit<metre>>>;
+  const a_type a(quantity<metre>(1), quantity<kilometre>(2));
+  b_type b;
+  b.set<0, 0>(3. / 1.m);
+  b.set<1, 0>(4. / 1.m);
+  const auto c = a * b;
+  CHECK(c.get<0, 0>().count() == 1 * 3 + 2000 * 4);
+}
+
+TEST_CASE("blocked multiplication of large matrices", "[matrix]")
+{
+  using big_rows = unit_list<metre, metre, metre, metre, metre, metre, metre, metre, metre, metre, metre, metre,
+                             metre, metre, metre, metre, metre, metre, metre, metre, metre, metre, metre, metre,
+                             metre, metre, metre, metre, metre, metre, metre, metre, metre, metre, metre, metre,
+                             metre, metre, metre, metre, metre, metre, metre, metre, metre, metre, metre, metre,
+                             metre, metre, metre, metre, metre, metre, metre, metre, metre, metre, metre, metre,
+                             metre, metre, metre, metre, metre, metre, metre, metre, metre, metre>;
+  using square = matrix<big_rows, big_rows>;
+  static_assert(square::rows == 70);
+
+  auto a = std::make_unique<square>();
+  auto b = std::make_unique<square>();
+  for(std::size_t i = 0; i < 70 * 70; ++i) {
+    a->data()[i] = static_cast<double>(i % 7);
+    b->data()[i] = static_cast<double>(i % 5);
+  }
+  const auto c = std::make_unique<decltype(*a * *b)>(*a * *b);
+  for(std::size_t i = 0; i < 70; i += 13)
+    for(std::size_t j = 0; j < 70; j += 11) {
+      double expected = 0;
+      for(std::size_t k = 0; k < 70; ++k) expected += a->data()[i * 70 + k] * b->data()[k * 70 + j];
+      CHECK(c->data()[i * 70 + j] == expected);
+    }
+}
@@ -0,0 +1,129 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/dimensions/area.h>
+#include <units/dimensions/length.h>
+#include <units/dimensions/time.h>
+#include <units/dimensions/velocity.h>
+#include <units/measurement.h>
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <sstream>
+
+using namespace units;
+
+namespace {
+
+  using M = measurement<double>;
+
+  static_assert(Scalar<M>);
+  static_assert(treat_as_floating_point<M>);
+  static_assert(std::is_same_v<std::common_type_t<M, std::intmax_t>, M>);
+
+  static_assert(M(3, 0.5) == M(3, 0.5));
+  static_assert(M(3, 0.5) < M(4, 0.1));
+  static_assert(M(3, 0.1) < M(3, 0.5));
+  static_assert(-M(3, 0.5) == M(-3, 0.5));
+
+  // exact numbers scale the uncertainty
+  static_assert(M(3, 0.5) * M(2) == M(6, 1));
+  static_assert(M(3, 0.5) / M(2) == M(1.5, 0.25));
+  static_assert(M(3, 0.5) + M(2) == M(5, 0.5));
+
+  static_assert(quantity_cast<quantity<metre, M>>(quantity<kilometre, M>(M(1.5, 0.01))).count() == M(1500, 10));
+
+}  // namespace
+
+TEST_CASE("measurement propagates uncertainties of uncorrelated operands", "[measurement]")
+{
+  const M a(10, 0.3);
+  const M b(5, 0.4);
+
+  CHECK((a + b).value() == 15);
+  CHECK((a + b).uncertainty() == Approx(0.5));
+  CHECK((a - b).uncertainty() == Approx(0.5));
+
+  // relative uncertainties add in quadrature for products and quotients
+  CHECK((a * b).value() == 50);
+  CHECK((a * b).relative_uncertainty() == Approx(std::hypot(0.03, 0.08)));
+  CHECK((a / b).value() == 2);
+  CHECK((a / b).relative_uncertainty() == Approx(std::hypot(0.03, 0.08)));
+
+  std::ostringstream os;
+  os << M(1.5, 0.25);
+  CHECK(os.str() == "1.5 ± 0.25");
+}
+
+TEST_CASE("measurement quantities", "[measurement]")
+{
+  const quantity<metre, M> d(M(100, 0.5));
+  const quantity<second, M> t(M(9.58, 0.01));
+
+  SECTION("derived units")
+  {
+    const quantity<metre_per_second, M> v = d / t;
+    CHECK(v.count().value() == Approx(100 / 9.58));
+    CHECK(v.count().relative_uncertainty() == Approx(std::hypot(0.005, 0.01 / 9.58)));
+  }
+
+  SECTION("conversion scales the value and the uncertainty")
+  {
+    const auto km = quantity_cast<kilometre>(d);
+    CHECK(km.count().value() == Approx(0.1));
+    CHECK(km.count().uncertainty() == Approx(0.0005));
+  }
+
+  SECTION("pow and sqrt use the derivative")
+  {
+    const auto area = pow<2>(d);
+    static_assert(std::is_same_v<decltype(area), const quantity<square_metre, M>>);
+    CHECK(area.count().value() == 10000);
+    CHECK(area.count().uncertainty() == Approx(100));  // 2 * 100 * 0.5, not sqrt(2) * 100 * 0.5
+
+    const auto side = sqrt(quantity<square_metre, M>(M(16, 0.8)));
+    CHECK(side.count().value() == 4);
+    CHECK(side.count().uncertainty() == Approx(0.1));
+
+    CHECK(pow<-1>(t).count().relative_uncertainty() == Approx(0.01 / 9.58));
+    CHECK(pow<3>(quantity<metre, M>(M(0, 1))).count().uncertainty() == 0);
+    CHECK(pow<0>(d) == M(1));
+  }
+}
+
+TEST_CASE("measurement_array stores values and uncertainties separately", "[measurement]")
+{
+  measurement_array<kilometre> a;
+  for(int i = 0; i < 100; ++i) a.push_back(quantity<kilometre, M>(M(i, 0.01 * i)));
+  CHECK(a.size() == 100);
+  CHECK(a.values()[7] == 7);
+  CHECK(a.uncertainties()[7] == Approx(0.07));
+
+  const measurement_array<metre> m = quantity_cast<metre>(a);
+  for(std::size_t i = 0; i < m.size(); ++i) {
+    CHECK(m[i].count().value() == Approx(1000. * static_cast<double>(i)));
+    CHECK(m[i].count().uncertainty() == Approx(10. * static_cast<double>(i)));
+    CHECK(m[i] == quantity_cast<metre>(a[i]));
+  }
+
+  a.set(0, quantity<kilometre, M>(M(1, 2)));
+  CHECK(a[0].count() == M(1, 2));
+}
@@ -0,0 +1,71 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/parse_unit.h>
+#include <catch2/catch.hpp>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace units;
+
+TEST_CASE("unit_conversion_cache parses every pair once", "[parse_unit]")
+{
+  unit_conversion_cache cache;
+
+  const auto c = cache.get("km/h", "m/s");
+  REQUIRE(c.has_value());
+  CHECK((*c)(36) == Approx(10));
+  CHECK(cache.get("km/h", "m/s")->factor == c->factor);
+  CHECK(cache.size() == 1);
+
+  CHECK(cache.get("m/s", "km/h")->factor == Approx(3.6));
+  CHECK(!cache.get("km/h", "m").has_value());
+  CHECK(!cache.get("km/h", "m").has_value());
+  CHECK(cache.size() == 3);
+
+  // ("m", "mm") and ("mm", "m") do not share a key
+  CHECK(cache.get("m", "mm")->factor == Approx(1000));
+  CHECK(cache.get("mm", "m")->factor == Approx(0.001));
+}
+
+TEST_CASE("unit_conversion_cache supports concurrent use", "[parse_unit][thread]")
+{
+  unit_conversion_cache cache;
+  const char* const exprs[] = {"m", "km", "mm", "mi", "ft", "in"};
+
+  std::atomic<bool> failed = false;
+  std::vector<std::thread> threads;
+  for(int t = 0; t < 4; ++t)
+    threads.emplace_back([&] {
+      for(int n = 0; n < 1000; ++n) {
+        const auto c = cache.get(exprs[n % 6], exprs[(n / 6) % 6]);
+        if(!c || c->factor <= 0)
+          failed = true;
+      }
+    });
+  for(auto& t : threads)
+    t.join();
+
+  CHECK(!failed);
+  CHECK(cache.size() == 36);
+}
@@ -0,0 +1,94 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/dimensions/length.h>
+#include <units/dimensions/pressure.h>
+#include <units/dimensions/time.h>
+#include <units/dimensions/velocity.h>
+#include <units/dimensions/voltage.h>
+#include <units/polynomial.h>
+#include <catch2/catch.hpp>
+#include <vector>
+
+using namespace units;
+
+namespace {
+
+  struct millivolt : prefixed_derived_unit<millivolt, milli, volt> {};
+  struct kilopascal : prefixed_derived_unit<kilopascal, kilo, pascal> {};
+
+  using V = quantity<volt>;
+  using mV = quantity<millivolt>;
+  using Pa = quantity<pascal>;
+  using kPa = quantity<kilopascal>;
+
+  // calibration curve: 100 Pa + 20 Pa/V * u + 0.5 Pa/V^2 * u^2
+  constexpr auto calibration = polynomial(Pa(100), Pa(20) / V(1), Pa(0.5) / (V(1) * V(1)));
+
+  static_assert(calibration.degree == 2);
+  static_assert(same_dim<decltype(calibration)::input_dimension, voltage>);
+  static_assert(same_dim<decltype(calibration)::output_dimension, pressure>);
+  static_assert(calibration(V(2)) == Pa(142));
+  static_assert(calibration(mV(2000)) == Pa(142));
+  static_assert(std::is_same_v<decltype(calibration(V(2))), Pa>);
+
+  // coefficients in different units of the same dimensions
+  static_assert(polynomial(kPa(1), Pa(20) / V(1))(mV(500)) == kPa(1.01));
+
+  // s = s0 + v0 * t + a / 2 * t^2
+  constexpr auto position = polynomial(quantity<metre>(1), quantity<metre_per_second>(2), quantity<metre>(3) / (quantity<second>(1) * quantity<second>(1)));
+  static_assert(position(quantity<second>(2)) == quantity<metre>(17));
+
+  template<typename... Cs>
+  concept valid_polynomial = requires { typename polynomial<Cs...>; };
+  static_assert(valid_polynomial<Pa, decltype(Pa(1) / V(1)), decltype(Pa(1) / (V(1) * V(1)))>);
+  static_assert(!valid_polynomial<Pa, decltype(Pa(1) / V(1)), Pa>);
+  static_assert(!valid_polynomial<Pa, decltype(Pa(1) / V(1)), decltype(Pa(1) / V(1))>);
+  static_assert(!valid_polynomial<Pa>);
+
+  template<typename P, typename X>
+  concept can_evaluate = requires(const P& p, X x) { p(x); };
+  static_assert(can_evaluate<decltype(calibration), mV>);
+  static_assert(!can_evaluate<decltype(calibration), Pa>);
+  static_assert(!can_evaluate<decltype(calibration), quantity<second>>);
+
+}  // namespace
+
+TEST_CASE("polynomial evaluates with Horner's scheme", "[polynomial]")
+{
+  const auto p = polynomial(Pa(-3), Pa(0.25) / V(1), Pa(1.5) / (V(1) * V(1)), Pa(-0.125) / (V(1) * V(1) * V(1)));
+  for(double u = -5; u <= 5; u += 0.5) {
+    const double expected = -3 + 0.25 * u + 1.5 * u * u - 0.125 * u * u * u;
+    CHECK(p(V(u)).count() == Approx(expected).margin(1e-12));
+  }
+  CHECK(p.coefficient<0>() == Pa(-3));
+}
+
+TEST_CASE("polynomial evaluates a range of quantities", "[polynomial]")
+{
+  std::vector<mV> in;
+  for(int i = 0; i < 1001; ++i) in.emplace_back(i * 7.5 - 3000.);
+  std::vector<Pa> out(in.size());
+  calibration(in, out);
+  for(std::size_t i = 0; i < in.size(); ++i) CHECK(out[i].count() == Approx(calibration(in[i]).count()));
+  CHECK(out[400].count() == Approx(100 + 20 * 0. + 0.5 * 0.));
+}
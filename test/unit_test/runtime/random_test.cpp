@@ -0,0 +1,203 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/random.h>
+#include <units/statistics.h>
+#include <units/dimensions/length.h>
+#include <units/dimensions/time.h>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace units;
+
+namespace {
+
+  static_assert(std::uniform_random_bit_generator<philox4x32>);
+  static_assert(std::is_same_v<decltype(normal_quantity_distribution(quantity<metre>(1), quantity<millimetre>(1))),
+                               normal_quantity_distribution<quantity<millimetre>>>);
+  static_assert(std::is_same_v<decltype(uniform_quantity_distribution(quantity<second, int>(1), quantity<second, int>(2))),
+                               uniform_quantity_distribution<quantity<second, int>>>);
+
+  // known-answer test of the reference implementation (Random123)
+  constexpr bool philox_zero_key()
+  {
+    philox4x32 g(0);
+    return g() == 0x6627e8d5 && g() == 0xe169c58d && g() == 0xbc57ac4c && g() == 0x9b00dbd8;
+  }
+  static_assert(philox_zero_key());
+
+  template<typename Q>
+  running_statistics<Q> statistics(const std::vector<Q>& v)
+  {
+    running_statistics<Q> s;
+    s.add(v);
+    return s;
+  }
+
+}  // namespace
+
+TEST_CASE("philox4x32 sequence", "[random]")
+{
+  SECTION("10000th value is the one required for std::philox4x32")
+  {
+    philox4x32 g;
+    g.discard(9999);
+    CHECK(g() == 1955073260u);
+  }
+
+  SECTION("generate() continues the sequence of operator()")
+  {
+    philox4x32 a(42);
+    philox4x32 b(42);
+    std::vector<std::uint32_t> v(2000);
+    for(std::size_t offset : {0, 1, 3, 4, 5}) {
+      for(std::size_t i = 0; i < offset; ++i) CHECK(a() == b());
+      const std::size_t n = 1027 - offset;
+      a.generate(std::span(v.data(), n));
+      for(std::size_t i = 0; i < n; ++i) REQUIRE(v[i] == b());
+      CHECK(a == b);
+    }
+  }
+
+  SECTION("discard() skips values")
+  {
+    for(unsigned long long z : {0ull, 1ull, 3ull, 4ull, 7ull, 1000ull}) {
+      philox4x32 a(7);
+      philox4x32 b(7);
+      a();
+      b();
+      a.discard(z);
+      for(unsigned long long i = 0; i < z; ++i) b();
+      CHECK(a == b);
+      CHECK(a() == b());
+    }
+  }
+
+  SECTION("different seeds give different streams")
+  {
+    philox4x32 a(1);
+    philox4x32 b(std::uint64_t(1) << 32);
+    CHECK(a != b);
+    CHECK(a() != b());
+  }
+}
+
+TEST_CASE("uniform_quantity_distribution", "[random]")
+{
+  SECTION("parameters are converted to the unit of the result")
+  {
+    const uniform_quantity_distribution<quantity<metre>> d(quantity<kilometre>(1), quantity<kilometre>(2));
+    CHECK(d.a() == quantity<metre>(1000));
+    CHECK(d.b() == quantity<metre>(2000));
+  }
+
+  SECTION("floating-point fill")
+  {
+    uniform_quantity_distribution<quantity<metre>> d(quantity<kilometre>(1), quantity<kilometre>(2));
+    philox4x32 g;
+    std::vector<quantity<metre>> v(100'001);
+    d.fill(v, g);
+    for(const auto& q : v) {
+      REQUIRE(q >= d.a());
+      REQUIRE(q < d.b());
+    }
+    const auto s = statistics(v);
+    CHECK(s.mean().count() == Approx(1500).epsilon(0.01));
+    CHECK(s.stddev().count() == Approx(1000 / std::sqrt(12.)).epsilon(0.01));
+  }
+
+  SECTION("float results rounded to b are kept below it")
+  {
+    // spacing of floats around 1e7 is 1 so that about 1/8 of the values round to `b`
+    uniform_quantity_distribution<quantity<metre, float>> d(quantity<metre, float>(1e7f),
+                                                            quantity<metre, float>(1e7f + 4));
+    std::vector<quantity<metre, float>> v(1000);
+    philox4x32 g;
+    d.fill(v, g);
+    for(const auto& q : v) REQUIRE(q < d.b());
+    std::mt19937 g2;
+    for(auto& q : v) q = d(g2);
+    for(const auto& q : v) REQUIRE(q < d.b());
+    CHECK(v.back() >= d.a());
+  }
+
+  SECTION("integral representation")
+  {
+    uniform_quantity_distribution<quantity<second, int>> d(quantity<second, int>(1), quantity<minute, int>(1));
+    std::mt19937 g;
+    std::vector<quantity<second, int>> v(10'000);
+    d.fill(v, g);
+    bool seen_min = false;
+    bool seen_max = false;
+    for(const auto& q : v) {
+      REQUIRE(q >= d.a());
+      REQUIRE(q <= d.b());
+      seen_min |= q == d.a();
+      seen_max |= q == d.b();
+    }
+    CHECK(seen_min);
+    CHECK(seen_max);
+  }
+}
+
+TEST_CASE("normal_quantity_distribution", "[random]")
+{
+  normal_quantity_distribution<quantity<millimetre>> d(quantity<metre>(2), quantity<centimetre>(3));
+  CHECK(d.mean() == quantity<millimetre>(2000));
+  CHECK(d.stddev() == quantity<millimetre>(30));
+
+  SECTION("single values")
+  {
+    std::mt19937_64 g;
+    std::vector<quantity<millimetre>> v(100'000);
+    for(auto& q : v) q = d(g);
+    const auto s = statistics(v);
+    CHECK(s.mean().count() == Approx(2000).epsilon(0.001));
+    CHECK(s.stddev().count() == Approx(30).epsilon(0.02));
+  }
+
+  SECTION("bulk fill")
+  {
+    philox4x32 g;
+    std::vector<quantity<millimetre>> v(100'001);
+    d.fill(v, g);
+    const auto s = statistics(v);
+    CHECK(s.mean().count() == Approx(2000).epsilon(0.001));
+    CHECK(s.stddev().count() == Approx(30).epsilon(0.02));
+
+    // fraction within one standard deviation
+    std::size_t inside = 0;
+    for(const auto& q : v) inside += abs(q - d.mean()) < d.stddev();
+    CHECK(static_cast<double>(inside) / static_cast<double>(v.size()) == Approx(0.6827).epsilon(0.01));
+  }
+
+  SECTION("float representation")
+  {
+    normal_quantity_distribution<quantity<second, float>> f(quantity<millisecond>(-5), quantity<millisecond>(1));
+    philox4x32 g(3);
+    std::vector<quantity<second, float>> v(10'000);
+    f.fill(v, g);
+    CHECK(statistics(v).mean().count() == Approx(-0.005).epsilon(0.01));
+  }
+}
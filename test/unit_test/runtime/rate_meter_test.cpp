@@ -0,0 +1,137 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/rate_meter.h>
+#include <units/dimensions/energy.h>
+#include <units/dimensions/frequency.h>
+#include <units/dimensions/power.h>
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace units;
+
+namespace {
+
+  static_assert(std::is_same_v<rate_of<quantity<joule, double>>, quantity<watt, double>>);
+  static_assert(std::is_same_v<rate_of<quantity<joule, std::int64_t>>, quantity<watt, double>>);
+  static_assert(std::is_same_v<rate_of<std::int64_t>, quantity<hertz, double>>);
+
+}  // namespace
+
+TEST_CASE("rate_meter averages since start", "[rate_meter]")
+{
+  rate_meter<quantity<joule, std::int64_t>> meter(quantity<second, double>(10));
+  meter.add(quantity<joule, std::int64_t>(100));
+  meter.add(quantity<joule, std::int64_t>(50));
+
+  const quantity<watt, double> p = meter.rate(quantity<second, double>(15));
+  CHECK(p.count() == 30);
+
+  meter.restart(quantity<second, double>(20));
+  CHECK(meter.rate(quantity<second, double>(21)).count() == 0);
+}
+
+TEST_CASE("rate_meter accepts std::chrono timestamps", "[rate_meter]")
+{
+  const std::chrono::steady_clock::time_point start{};
+
+  rate_meter<std::int64_t> requests(start);
+  for(int i = 0; i < 20; ++i) requests.add(1);
+
+  CHECK(requests.rate(start + std::chrono::seconds(4)).count() == 5);
+  CHECK(requests.rate(start + std::chrono::milliseconds(500)).count() == 40);
+}
+
+TEST_CASE("ewma_rate converges to a steady rate", "[rate_meter]")
+{
+  ewma_rate<quantity<joule, double>> power(quantity<second, double>(1), quantity<second, double>(5));
+  for(int i = 0; i < 100; ++i) {
+    power.add(quantity<kilojoule, double>(2));
+    power.tick();
+  }
+  CHECK(power.rate().count() == Approx(2000));
+}
+
+TEST_CASE("ewma_rate decays with the configured time constant", "[rate_meter]")
+{
+  ewma_rate<std::int64_t> rate(quantity<second, double>(1), quantity<second, double>(10));
+  rate.add(10);
+  rate.tick();
+  const double alpha = 1 - std::exp(-0.1);
+  CHECK(rate.rate().count() == Approx(10 * alpha));
+
+  rate.tick();
+  CHECK(rate.rate().count() == Approx(10 * alpha * (1 - alpha)));
+}
+
+TEST_CASE("windowed_rate averages the last N intervals", "[rate_meter]")
+{
+  windowed_rate<quantity<joule, std::int64_t>, 4> power(quantity<second, double>(2));
+  const std::int64_t samples[] = {8, 16, 0, 8, 24};
+  for(auto s : samples) {
+    power.add(quantity<joule, std::int64_t>(s));
+    power.tick();
+  }
+  // window holds {16, 0, 8, 24} over 8 s
+  CHECK(power.rate().count() == 6);
+}
+
+TEST_CASE("windowed_rate does not accumulate rounding errors", "[rate_meter]")
+{
+  windowed_rate<quantity<joule, double>, 4> power(quantity<second, double>(1));
+  for(int i = 0; i < 10'000; ++i) {
+    power.add(quantity<joule, double>(i % 7 == 0 ? 1e9 : 0.1));
+    power.tick();
+  }
+  for(int i = 0; i < 4; ++i) {
+    power.tick();
+  }
+  CHECK(power.rate().count() == 0);
+}
+
+TEST_CASE("rate meters do not lose concurrent increments", "[rate_meter]")
+{
+  constexpr int threads = 4;
+  constexpr int iterations = 10000;
+
+  windowed_rate<std::int64_t, 1> rate(quantity<second, double>(1));
+  std::vector<std::thread> workers;
+  for(int t = 0; t < threads; ++t)
+    workers.emplace_back([&] {
+      for(int i = 0; i < iterations; ++i) rate.add(1);
+    });
+  std::int64_t ticks = 0;
+  double total = 0;
+  for(; ticks < 100; ++ticks) {
+    rate.tick();
+    total += rate.rate().count();
+  }
+  for(auto& w : workers) w.join();
+  rate.tick();
+  total += rate.rate().count();
+
+  CHECK(total == threads * iterations);
+}
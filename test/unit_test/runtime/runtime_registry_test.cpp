@@ -0,0 +1,177 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/runtime_registry.h>
+#include <units/dimensions/si_units.h>
+#include <catch2/catch.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace units;
+
+TEST_CASE("runtime_registry seeded with compile-time units", "[runtime_registry]")
+{
+  const runtime_registry reg(si_units{});
+
+  REQUIRE(reg.find("km") != nullptr);
+  CHECK(reg.find("km")->unit == runtime_unit_of<kilometre>);
+  CHECK(reg.find("km")->unit.factor == 1000);
+  CHECK(reg.find("µs")->unit.dimension == dimension_code_of<units::time>);
+  CHECK(reg.find("kJ")->unit.dimension == dimension_code_of<energy>);
+  CHECK(reg.find("parsec") == nullptr);
+}
+
+TEST_CASE("runtime_registry extended at runtime", "[runtime_registry]")
+{
+  runtime_registry reg(si_units{});
+  const auto size = reg.size();
+
+  SECTION("unit with explicit dimension and factor")
+  {
+    REQUIRE(reg.add("kWh", "kilowatt hour", runtime_unit{dimension_code_of<energy>, 3.6e6}));
+    CHECK(reg.size() == size + 1);
+    CHECK(reg.find("kWh") == reg.find("kilowatt hour"));
+    CHECK(reg.find("kWh")->unit.factor == 3.6e6);
+  }
+
+  SECTION("unit defined in terms of a registered one")
+  {
+    REQUIRE(reg.add("bbl", "barrel", 0.158987294928, "m³"));
+    CHECK(reg.find("barrel")->unit.dimension == dimension_code_of<volume>);
+    CHECK(reg.find("barrel")->unit.factor == Approx(0.158987294928));
+  }
+
+  SECTION("duplicates are rejected")
+  {
+    CHECK(!reg.add("km", "kilometre", runtime_unit_of<kilometre>));
+    REQUIRE(reg.add("nmi", "nautical mile", 1852, "m"));
+    CHECK(!reg.add("NM", "nautical mile", 1852, "m"));
+    CHECK(!reg.add("x", "y", 1, "unknown"));
+    CHECK(reg.size() == size + 1);
+  }
+
+  SECTION("symbol equal to the name is rejected")
+  {
+    CHECK(!reg.add("xu", "xu", runtime_unit_of<metre>));
+    CHECK(!reg.add("", "empty", runtime_unit_of<metre>));
+    CHECK(reg.size() == size);
+  }
+
+  SECTION("many units at once")
+  {
+    const std::vector<runtime_registry::entry> entries{
+        {"nmi", "nautical mile", runtime_unit{dimension_code_of<length>, 1852}},
+        {"km", "", runtime_unit_of<kilometre>},                                       // taken
+        {"NM", "nautical mile", runtime_unit{dimension_code_of<length>, 1852}},       // clashes with the first one
+        {"kWh", "kilowatt hour", runtime_unit{dimension_code_of<energy>, 3.6e6}}};
+    CHECK(reg.add_all(entries) == 2);
+    CHECK(reg.size() == size + 2);
+    CHECK(reg.find("nautical mile") == reg.find("nmi"));
+    CHECK(reg.find("NM") == nullptr);
+    CHECK(reg.find("kWh")->unit.factor == 3.6e6);
+    CHECK(reg.add_all(entries) == 0);
+  }
+}
+
+TEST_CASE("runtime_registry conversions", "[runtime_registry][conversion]")
+{
+  runtime_registry reg(si_units{});
+  reg.add("kWh", "kilowatt hour", 3.6, "MJ");
+
+  const auto c = reg.conversion("kWh", "kJ");
+  REQUIRE(c.has_value());
+  CHECK((*c)(2) == Approx(7200));
+
+  CHECK(reg.conversion("km", "mi")->factor == Approx(1 / 1.609344));
+  CHECK(!reg.conversion("km", "s").has_value());
+  CHECK(!reg.conversion("km", "unknown").has_value());
+}
+
+TEST_CASE("runtime_registry supports concurrent readers and a writer", "[runtime_registry][thread]")
+{
+  runtime_registry reg(si_units{});
+  constexpr int units_count = 200;
+
+  std::atomic<bool> failed = false;
+
+  std::vector<std::thread> readers;
+  for(int i = 0; i < 4; ++i)
+    readers.emplace_back([&] {
+      for(int n = 0; n < 10'000; ++n) {
+        const auto* km = reg.find("km");
+        if(km == nullptr || km->unit.factor != 1000)
+          failed = true;
+        const auto* u = reg.find("u" + std::to_string(n % units_count));
+        if(u != nullptr && u->unit.factor != n % units_count + 1.)
+          failed = true;
+      }
+    });
+
+  for(int i = 0; i < units_count; ++i)
+    reg.add("u" + std::to_string(i), std::string(), i + 1., "m");
+
+  for(auto& t : readers)
+    t.join();
+
+  CHECK(!failed);
+  for(int i = 0; i < units_count; ++i)
+    REQUIRE(reg.find("u" + std::to_string(i))->unit.factor == i + 1.);
+}
+
+TEST_CASE("runtime_registry supports concurrent readers and batch reloads", "[runtime_registry][thread]")
+{
+  runtime_registry reg(si_units{});
+  constexpr int reloads = 100;
+  constexpr int units_count = 20;
+
+  std::atomic<bool> done = false;
+  std::atomic<bool> failed = false;
+
+  std::vector<std::thread> readers;
+  for(int i = 0; i < 64; ++i)
+    readers.emplace_back([&] {
+      for(int n = 0; !done; ++n) {
+        const auto c = reg.conversion("km", "m");
+        if(!c || c->factor != 1000)
+          failed = true;
+        const auto* u = reg.find("r" + std::to_string(n % (reloads * units_count)));
+        if(u != nullptr && u->unit.dimension != dimension_code_of<length>)
+          failed = true;
+      }
+    });
+
+  for(int r = 0; r < reloads; ++r) {
+    std::vector<runtime_registry::entry> entries;
+    for(int i = 0; i < units_count; ++i)
+      entries.push_back({"r" + std::to_string(r * units_count + i), std::string(), runtime_unit_of<metre>});
+    reg.add_all(std::move(entries));
+  }
+  done = true;
+
+  for(auto& t : readers)
+    t.join();
+
+  CHECK(!failed);
+  CHECK(reg.find("r" + std::to_string(reloads * units_count - 1)) != nullptr);
+}
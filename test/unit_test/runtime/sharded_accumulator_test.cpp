@@ -0,0 +1,79 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/sharded_accumulator.h>
+#include <units/dimensions/length.h>
+#include <units/dimensions/time.h>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace units;
+
+namespace {
+
+  template<typename A, typename Q>
+  concept can_add = requires(A& a, Q q) { a.add(q); };
+
+  using metres = quantity<metre, std::int64_t>;
+
+  static_assert(can_add<sharded_accumulator<metres>, metres>);
+  static_assert(can_add<sharded_accumulator<metres>, quantity<kilometre, std::int64_t>>);
+  static_assert(!can_add<sharded_accumulator<metres>, quantity<millimetre, std::int64_t>>);
+  static_assert(!can_add<sharded_accumulator<metres>, quantity<second, std::int64_t>>);
+
+}  // namespace
+
+TEST_CASE("sharded_accumulator rounds shard count to a power of 2", "[sharded_accumulator]")
+{
+  CHECK(sharded_accumulator<metres>(0).shard_count() == 1);
+  CHECK(sharded_accumulator<metres>(3).shard_count() == 4);
+  CHECK(sharded_accumulator<metres>(8).shard_count() == 8);
+}
+
+TEST_CASE("sharded_accumulator converts units on add", "[sharded_accumulator]")
+{
+  sharded_accumulator<quantity<metre, double>> acc(4);
+  acc.add(quantity<metre, double>(1.5));
+  acc.add(quantity<kilometre, double>(2));
+  CHECK(acc.value().count() == 2001.5);
+
+  CHECK(acc.reset().count() == 2001.5);
+  CHECK(acc.value().count() == 0);
+}
+
+TEST_CASE("sharded_accumulator sums concurrent updates", "[sharded_accumulator]")
+{
+  constexpr int threads = 8;
+  constexpr int iterations = 10000;
+
+  sharded_accumulator<metres> acc(4);  // fewer shards than threads
+  std::vector<std::thread> workers;
+  for(int t = 0; t < threads; ++t)
+    workers.emplace_back([&] {
+      for(int i = 0; i < iterations; ++i) acc.add(quantity<kilometre, std::int64_t>(1));
+    });
+  for(auto& w : workers) w.join();
+
+  CHECK(acc.value().count() == threads * iterations * 1000);
+}
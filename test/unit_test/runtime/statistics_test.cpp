@@ -0,0 +1,115 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/statistics.h>
+#include <units/dimensions/area.h>
+#include <units/dimensions/length.h>
+#include <units/dimensions/time.h>
+#include <catch2/catch.hpp>
+#include <cstdint>
+#include <vector>
+
+using namespace units;
+
+namespace {
+
+  static_assert(std::is_same_v<running_statistics<quantity<metre>>::mean_type, quantity<metre>>);
+  static_assert(std::is_same_v<running_statistics<quantity<metre>>::variance_type, quantity<square_metre>>);
+  static_assert(std::is_same_v<running_statistics<quantity<kilometre>>::variance_type, quantity<square_kilometre>>);
+  static_assert(std::is_same_v<running_statistics<quantity<second, std::int64_t>>::mean_type, quantity<second, double>>);
+
+  constexpr running_statistics<quantity<metre>> make(std::initializer_list<double> values)
+  {
+    running_statistics<quantity<metre>> s;
+    for(double v : values) s.add(quantity<metre>(v));
+    return s;
+  }
+
+  static_assert(make({2, 4, 4, 4, 5, 5, 7, 9}).mean() == quantity<metre>(5));
+  static_assert(make({2, 4, 4, 4, 5, 5, 7, 9}).variance() == quantity<square_metre>(4));
+  static_assert(make({}).variance() == quantity<square_metre>(0));
+
+}  // namespace
+
+TEST_CASE("running_statistics mean, variance and stddev", "[statistics]")
+{
+  running_statistics<quantity<metre>> s;
+  for(double v : {2., 4., 4., 4., 5., 5., 7., 9.}) s.add(quantity<metre>(v));
+
+  CHECK(s.count() == 8);
+  CHECK(s.mean() == quantity<metre>(5));
+  CHECK(s.variance() == quantity<square_metre>(4));
+  CHECK(s.stddev() == quantity<metre>(2));
+  CHECK(s.sample_variance().count() == Approx(32. / 7));
+}
+
+TEST_CASE("running_statistics converts units on add", "[statistics]")
+{
+  running_statistics<quantity<metre>> s;
+  s.add(quantity<kilometre, std::int64_t>(1));
+  s.add(quantity<metre>(3000));
+  CHECK(s.mean() == quantity<metre>(2000));
+  CHECK(s.stddev() == quantity<metre>(1000));
+}
+
+TEST_CASE("running_statistics is numerically stable", "[statistics]")
+{
+  running_statistics<quantity<second>> s;
+  for(int i = 0; i < 1000; ++i) s.add(quantity<second>(1e9 + (i % 2 ? 1 : -1)));
+  CHECK(s.mean().count() == Approx(1e9));
+  CHECK(s.variance().count() == Approx(1));
+}
+
+TEST_CASE("running_statistics merge matches a single pass", "[statistics]")
+{
+  running_statistics<quantity<metre>> all, a, b, empty;
+  for(int i = 0; i < 100; ++i) {
+    const quantity<metre> x(i * 0.5 + (i % 7));
+    all.add(x);
+    (i < 30 ? a : b).add(x);
+  }
+  a.merge(b);
+  a.merge(empty);
+  CHECK(a.count() == all.count());
+  CHECK(a.mean().count() == Approx(all.mean().count()));
+  CHECK(a.variance().count() == Approx(all.variance().count()));
+
+  empty.merge(all);
+  CHECK(empty.variance().count() == Approx(all.variance().count()));
+}
+
+TEST_CASE("running_statistics batch update matches a single pass", "[statistics]")
+{
+  std::vector<quantity<millisecond, std::int64_t>> xs;
+  for(std::int64_t i = 0; i < 103; ++i) xs.emplace_back(i * i % 17);
+
+  running_statistics<quantity<millisecond, std::int64_t>> one_by_one, batch;
+  for(const auto& x : xs) one_by_one.add(x);
+  batch.add(quantity<millisecond, std::int64_t>(3));
+  batch.add(std::span(xs).subspan(0, 50));
+  batch.add(std::span(xs).subspan(50));
+  one_by_one.add(quantity<millisecond, std::int64_t>(3));
+
+  CHECK(batch.count() == one_by_one.count());
+  CHECK(batch.mean().count() == Approx(one_by_one.mean().count()));
+  CHECK(batch.variance().count() == Approx(one_by_one.variance().count()));
+}
@@ -0,0 +1,138 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/latency_histogram.h>
+#include <units/stopwatch.h>
+#include <catch2/catch.hpp>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace units;
+
+TEST_CASE("stopwatch measures elapsed time", "[stopwatch]")
+{
+  stopwatch sw;
+  std::this_thread::sleep_for(std::chrono::milliseconds(2));
+  const quantity<nanosecond, std::int64_t> elapsed = sw.elapsed();
+  CHECK(elapsed >= quantity<millisecond, std::int64_t>(2));
+
+  const auto lap = sw.lap();
+  CHECK(lap >= elapsed);
+  CHECK(sw.elapsed() < lap);
+}
+
+TEST_CASE("scoped_timer reports its lifetime", "[stopwatch]")
+{
+  quantity<nanosecond, std::int64_t> reported(-1);
+  {
+    scoped_timer timer([&](quantity<nanosecond, std::int64_t> t) { reported = t; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  CHECK(reported >= quantity<millisecond, std::int64_t>(1));
+}
+
+#ifdef UNITS_HAS_TSC_CLOCK
+
+TEST_CASE("tsc_clock agrees with steady_clock", "[stopwatch]")
+{
+  tsc_clock::calibrate();
+  basic_stopwatch<tsc_clock> tsc;
+  stopwatch steady;
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  const auto t = tsc.elapsed();
+  const auto s = steady.elapsed();
+  CHECK(t.count() == Approx(s.count()).epsilon(0.1));
+}
+
+#endif
+
+TEST_CASE("latency_histogram percentiles", "[latency_histogram]")
+{
+  latency_histogram<> h;
+  CHECK(h.percentile(50) == quantity<nanosecond, std::int64_t>(0));
+
+  for(int i = 1; i <= 100; ++i) {
+    h.record(quantity<microsecond, std::int64_t>(i));
+  }
+  CHECK(h.count() == 100);
+
+  // values are reported as the upper bound of their bucket, within 2^-5 relative error
+  const auto p50 = h.percentile(50);
+  CHECK(p50 >= quantity<microsecond, std::int64_t>(50));
+  CHECK(static_cast<double>(p50.count()) <= 50'000 * (1 + 1. / 32));
+
+  const auto p99 = h.percentile(99);
+  CHECK(p99 >= quantity<microsecond, std::int64_t>(99));
+  CHECK(static_cast<double>(p99.count()) <= 99'000 * (1 + 1. / 32));
+
+  CHECK(h.percentile(100) >= quantity<microsecond, std::int64_t>(100));
+  CHECK(h.percentile(0) >= quantity<microsecond, std::int64_t>(1));
+  CHECK(h.percentile(0) < quantity<microsecond, std::int64_t>(2));
+
+  h.reset();
+  CHECK(h.count() == 0);
+}
+
+TEST_CASE("latency_histogram small values are exact", "[latency_histogram]")
+{
+  latency_histogram<4> h;
+  for(int i = 0; i < 16; ++i) {
+    h.record(quantity<nanosecond, std::int64_t>(i));
+  }
+  CHECK(h.percentile(50).count() == 7);
+  CHECK(h.percentile(100).count() == 15);
+
+  h.record(quantity<nanosecond, std::int64_t>(-5));
+  CHECK(h.percentile(0).count() == 0);
+}
+
+TEST_CASE("latency_histogram covers the whole int64_t range", "[latency_histogram]")
+{
+  latency_histogram<> h;
+  h.record(quantity<nanosecond, std::int64_t>::max());
+  CHECK(h.percentile(100) == quantity<nanosecond, std::int64_t>::max());
+
+  h.record(std::chrono::seconds(1));
+  CHECK(h.percentile(50) >= quantity<second, std::int64_t>(1));
+}
+
+TEST_CASE("latency_histogram concurrent recording", "[latency_histogram]")
+{
+  constexpr int threads = 4;
+  constexpr int iterations = 10000;
+
+  latency_histogram<> h;
+  std::vector<std::thread> workers;
+  for(int t = 0; t < threads; ++t)
+    workers.emplace_back([&] {
+      for(int i = 0; i < iterations; ++i) {
+        h.record(quantity<nanosecond, std::int64_t>(i));
+      }
+    });
+  for(auto& w : workers) {
+    w.join();
+  }
+
+  CHECK(h.count() == threads * iterations);
+}
@@ -0,0 +1,168 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/dimensions/length.h>
+#include <units/dimensions/time.h>
+#include <units/transcendental.h>
+#include <catch2/catch.hpp>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace units;
+
+namespace {
+
+  static_assert(std::is_same_v<decltype(sin(1.rad)), long double>);
+  static_assert(std::is_same_v<decltype(sin(quantity<degree, float>(1))), float>);
+  static_assert(std::is_same_v<decltype(cos(90deg)), double>);
+  static_assert(std::is_same_v<decltype(exponential(quantity<percent>(1))), double>);
+
+  template<typename Q>
+  concept has_sin = requires(Q q) { sin(q); };
+  static_assert(has_sin<quantity<radian>>);
+  static_assert(has_sin<quantity<degree, int>>);
+  static_assert(!has_sin<quantity<metre>>);
+  static_assert(!has_sin<quantity<one>>);
+
+  template<typename Q>
+  concept has_exponential = requires(Q q) { exponential(q); log(q); };
+  static_assert(has_exponential<quantity<one>>);
+  static_assert(has_exponential<quantity<percent>>);
+  static_assert(!has_exponential<quantity<second>>);
+  static_assert(!has_exponential<quantity<radian>>);
+
+  template<typename In, typename Out>
+  concept has_range_sin = requires(const In& in, Out& out) { sin(in, out); };
+  static_assert(has_range_sin<std::vector<quantity<degree>>, std::vector<double>>);
+  static_assert(!has_range_sin<std::vector<quantity<metre>>, std::vector<double>>);
+
+  constexpr double pi = 3.14159265358979323846;
+
+  // within a few ulp of the standard library
+  bool close(double x, double ref, double abs_tol = 0)
+  {
+    return std::abs(x - ref) <= std::max(4 * std::numeric_limits<double>::epsilon() * std::abs(ref), abs_tol);
+  }
+
+}  // namespace
+
+TEST_CASE("sin and cos of radians match the standard library", "[transcendental]")
+{
+  for(double x = -1000; x <= 1000; x += 0.0137) {
+    INFO("x = " << x);
+    CHECK(close(sin(quantity<radian>(x)), std::sin(x), 1e-15));
+    CHECK(close(cos(quantity<radian>(x)), std::cos(x), 1e-15));
+  }
+}
+
+TEST_CASE("sin and cos of degrees are reduced in degrees", "[transcendental]")
+{
+  CHECK(sin(30deg) == Approx(0.5).epsilon(1e-15));
+  CHECK(cos(60deg) == Approx(0.5).epsilon(1e-15));
+  CHECK(sin(90deg) == 1);
+  CHECK(cos(0deg) == 1);
+  CHECK(std::abs(cos(90deg)) < 1e-16);
+  CHECK(std::abs(sin(quantity<degree>(3600.))) < 1e-14);  // degree is pi/180 to 2.5e-17
+  CHECK(sin(-30deg) == Approx(-0.5).epsilon(1e-15));
+
+  for(double x = -3600; x <= 3600; x += 0.731) {
+    INFO("x = " << x);
+    // the reference rounds x * pi / 180, so it is itself off by about an ulp of the angle in radians
+    const double tol = 2e-16 + 3e-16 * std::abs(x * pi / 180);
+    CHECK(close(sin(quantity<degree>(x)), std::sin(x * pi / 180), tol));
+    CHECK(close(cos(quantity<degree>(x)), std::cos(x * pi / 180), tol));
+  }
+}
+
+TEST_CASE("sin and cos outside the kernel range fall back to the standard library", "[transcendental]")
+{
+  CHECK(sin(quantity<radian>(1e12)) == std::sin(1e12));
+  CHECK(cos(quantity<radian>(-1e12)) == std::cos(-1e12));
+  CHECK(std::isnan(sin(quantity<radian>(std::numeric_limits<double>::infinity()))));
+  CHECK(std::isnan(cos(quantity<degree>(std::numeric_limits<double>::quiet_NaN()))));
+}
+
+TEST_CASE("exponential of dimensionless quantities", "[transcendental]")
+{
+  for(double x = -745; x <= 709; x += 0.173) {
+    INFO("x = " << x);
+    CHECK(close(exponential(quantity<one>(x)), std::exp(x)));
+  }
+  CHECK(exponential(quantity<one>(0.)) == 1);
+  CHECK(close(exponential(quantity<percent>(100.)), std::exp(1.)));
+  CHECK(close(exponential(quantity<percent>(-250.)), std::exp(-2.5)));
+  CHECK(exponential(quantity<one>(710.)) == std::numeric_limits<double>::infinity());
+  CHECK(exponential(quantity<one>(-1e300)) == 0);
+  CHECK(exponential(quantity<one>(-std::numeric_limits<double>::infinity())) == 0);
+  CHECK(std::isnan(exponential(quantity<one>(std::numeric_limits<double>::quiet_NaN()))));
+}
+
+TEST_CASE("log of dimensionless quantities", "[transcendental]")
+{
+  for(double x = 1e-300; x < 1e300; x *= 1.37) {
+    INFO("x = " << x);
+    CHECK(close(log(quantity<one>(x)), std::log(x), 1e-15));
+  }
+  CHECK(log(quantity<one>(1.)) == 0);
+  CHECK(close(log(quantity<one>(5e-320)), std::log(5e-320)));  // subnormal
+  CHECK(std::abs(log(quantity<percent>(100.))) < 1e-15);
+  CHECK(close(log(quantity<parts_per_million>(3.)), std::log(3e-6)));
+  CHECK(log(quantity<one>(0.)) == -std::numeric_limits<double>::infinity());
+  CHECK(std::isnan(log(quantity<one>(-1.))));
+  CHECK(log(quantity<one>(std::numeric_limits<double>::infinity())) == std::numeric_limits<double>::infinity());
+}
+
+TEST_CASE("integral and long double representations", "[transcendental]")
+{
+  CHECK(sin(90deg) == 1.);
+  CHECK(exponential(quantity<one, int>(1)) == Approx(std::exp(1.)));
+  CHECK(cos(quantity<degree, long double>(60)) == Approx(0.5L));
+  CHECK(log(quantity<percent, long double>(1000)) == Approx(std::log(10.L)));
+}
+
+TEST_CASE("range overloads match the scalar functions", "[transcendental]")
+{
+  std::vector<quantity<degree>> angles;
+  for(double x = -720; x <= 720; x += 1.25) angles.emplace_back(x);
+  angles.emplace_back(1e300);
+
+  std::vector<double> s(angles.size());
+  std::vector<double> c(angles.size());
+  sin(angles, s);
+  cos(angles, c);
+  for(std::size_t i = 0; i < angles.size(); ++i) {
+    CHECK(s[i] == sin(angles[i]));
+    CHECK(c[i] == cos(angles[i]));
+  }
+
+  const std::vector<quantity<percent, float>> ratios = {quantity<percent, float>(1), quantity<percent, float>(50),
+                                                           quantity<percent, float>(100), quantity<percent, float>(250)};
+  std::vector<float> e(ratios.size());
+  std::vector<float> l(ratios.size());
+  exponential(ratios, e);
+  log(ratios, l);
+  for(std::size_t i = 0; i < ratios.size(); ++i) {
+    CHECK(e[i] == exponential(ratios[i]));
+    CHECK(l[i] == log(ratios[i]));
+  }
+}
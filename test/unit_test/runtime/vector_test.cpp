@@ -0,0 +1,115 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/dimensions/energy.h>
+#include <units/dimensions/force.h>
+#include <units/dimensions/length.h>
+#include <units/dimensions/time.h>
+#include <units/dimensions/velocity.h>
+#include <units/vector.h>
+#include <catch2/catch.hpp>
+#include <sstream>
+
+using namespace units;
+
+namespace {
+
+  using position = vec<3, quantity<metre>>;
+  using force_vec = vec<3, quantity<newton>>;
+
+  static_assert(sizeof(position) == 32);
+  static_assert(alignof(position) == 32);
+  static_assert(alignof(vec<2, quantity<metre>>) == 16);
+  static_assert(alignof(vec<4, quantity<metre, float>>) == 16);
+  static_assert(alignof(vec<16, quantity<metre>>) == 64);
+  static_assert(std::is_trivially_copyable_v<position>);
+
+  static_assert(std::is_same_v<decltype(vec(1m, 2m, 3m)), vec<3, quantity<metre, std::int64_t>>>);
+  static_assert(vec(1m, 2m, 3m)[1] == 2m);
+  static_assert(position() == position(0m, 0m, 0m));
+  static_assert(position::filled(2m) == position(2m, 2m, 2m));
+
+  // conversions follow the quantity rules
+  static_assert(std::is_convertible_v<vec<3, quantity<kilometre, std::int64_t>>, vec<3, quantity<metre, std::int64_t>>>);
+  static_assert(!std::is_convertible_v<vec<3, quantity<metre, std::int64_t>>, vec<3, quantity<kilometre, std::int64_t>>>);
+  static_assert(!std::is_convertible_v<position, force_vec>);
+
+  // arithmetic
+  static_assert(vec(1m, 2m) + vec(3m, 4m) == vec(4m, 6m));
+  static_assert(vec(1km, 2km) - vec(1m, 2m) == vec(999m, 1998m));
+  static_assert(-vec(1m, 2m) == vec(-1m, -2m));
+  static_assert(vec(1m, 2m) * 2 == vec(2m, 4m));
+  static_assert(2 * vec(1m, 2m) == vec(2m, 4m));
+  static_assert(vec(2m, 4m) / 2 == vec(1m, 2m));
+  static_assert(vec(2m, 4m) * 3N == vec(6_J, 12_J));
+  static_assert(vec(10m, 20m) / 5s == vec(2mps, 4mps));
+  static_assert(elementwise_multiply(vec(1m, 2m), vec(3N, 4N)) == vec(3_J, 8_J));
+  static_assert(elementwise_divide(vec(6m, 8m), vec(3s, 4s)) == vec(2mps, 2mps));
+
+  // dot and cross
+  static_assert(dot(vec(1m, 2m, 3m), vec(4N, 5N, 6N)) == 32_J);
+  static_assert(dot(vec(1km, 2km), vec(1N, 1N)) == 3000_J);
+  static_assert(dot(vec(1m, 2m), vec(3m, 4m)) == 11sq_m);
+  static_assert(std::is_same_v<decltype(cross(position(), force_vec())), vec<3, quantity<joule>>>);
+  static_assert(cross(vec(1m, 0m, 0m), vec(0N, 1N, 0N)) == vec(0_J, 0_J, 1_J));
+
+  template<typename A, typename B>
+  concept can_add = requires(A a, B b) { a + b; };
+  static_assert(!can_add<position, force_vec>);
+  static_assert(!can_add<vec<2, quantity<metre>>, vec<3, quantity<metre>>>);
+
+}  // namespace
+
+TEST_CASE("vec arithmetic", "[vector]")
+{
+  position p(1.m, 2.m, 3.m);
+  p += position(1.m, 1.m, 1.m);
+  CHECK(p == position(2.m, 3.m, 4.m));
+  p -= position(2.m, 2.m, 2.m);
+  CHECK(p == position(0.m, 1.m, 2.m));
+  p *= 2;
+  CHECK(p == position(0.m, 2.m, 4.m));
+  p /= 4;
+  CHECK(p == position(0.m, 0.5m, 1.m));
+  p.set(0, 7.m);
+  CHECK(p[0] == 7.m);
+  CHECK(p.data()[0] == 7.);
+}
+
+TEST_CASE("vec norm and torque", "[vector]")
+{
+  CHECK(norm(vec(3.m, 4.m)) == 5.m);
+  CHECK(norm(vec(3m, 4m)) == quantity<metre>(5.));
+
+  const position r(0.m, 2.m, 0.m);
+  const force_vec f(3.N, 0.N, 0.N);
+  const vec<3, quantity<joule>> torque = cross(r, f);
+  CHECK(torque == vec<3, quantity<joule>>(0._J, 0._J, -6._J));
+  CHECK(dot(torque, r).count() == 0);
+}
+
+TEST_CASE("vec text output", "[vector]")
+{
+  std::ostringstream os;
+  os << vec(1m, 2m, 3m);
+  CHECK(os.str() == "(1 m, 2 m, 3 m)");
+}
@@ -0,0 +1,86 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/chrono.h>
+#include <units/dimensions/velocity.h>
+#include <chrono>
+#include <utility>
+
+namespace {
+
+  using namespace units;
+  using std::chrono::duration;
+
+  // unit mapping
+
+  static_assert(std::is_same_v<quantity_like_traits<std::chrono::seconds>::unit, second>);
+  static_assert(std::is_same_v<quantity_like_traits<std::chrono::milliseconds>::unit, millisecond>);
+  static_assert(std::is_same_v<quantity_like_traits<std::chrono::nanoseconds>::unit, nanosecond>);
+  static_assert(std::is_same_v<quantity_like_traits<std::chrono::minutes>::unit, minute>);
+  static_assert(std::is_same_v<quantity_like_traits<std::chrono::hours>::unit, hour>);
+  static_assert(std::is_same_v<quantity_like_traits<duration<int, std::ratio<2>>>::unit::ratio, ratio<2>>);
+
+  static_assert(QuantityLike<std::chrono::seconds>);
+  static_assert(!QuantityLike<quantity<second>>);
+  static_assert(!QuantityLike<int>);
+
+  // construction
+
+  static_assert(std::is_same_v<decltype(quantity(std::chrono::milliseconds(1))), quantity<millisecond, std::chrono::milliseconds::rep>>);
+  static_assert(quantity<millisecond, std::int64_t>(std::chrono::milliseconds(42)).count() == 42);
+  static_assert(quantity<millisecond, std::int64_t>(std::chrono::seconds(2)).count() == 2000);
+  static_assert(quantity<second, double>(std::chrono::milliseconds(1500)).count() == 1.5);
+  static_assert(quantity<minute, int>(std::chrono::hours(2)).count() == 120);
+
+  static_assert(std::is_convertible_v<std::chrono::seconds, quantity<millisecond, std::int64_t>>);
+  static_assert(!std::is_convertible_v<std::chrono::milliseconds, quantity<second, std::int64_t>>);  // truncating
+  static_assert(!std::is_convertible_v<duration<double>, quantity<second, std::int64_t>>);           // truncating
+  static_assert(std::is_constructible_v<quantity<second, std::int64_t>, std::chrono::milliseconds>);
+  static_assert(quantity<second, std::int64_t>(std::chrono::milliseconds(2500)).count() == 2);
+  static_assert(!std::is_constructible_v<quantity<metre_per_second>, std::chrono::seconds>);         // dimension
+
+  // conversion to std::chrono::duration
+
+  static_assert(std::chrono::milliseconds(quantity<second, std::int64_t>(3)).count() == 3000);
+  static_assert(std::is_convertible_v<quantity<second, std::int64_t>, std::chrono::milliseconds>);
+  static_assert(!std::is_convertible_v<quantity<millisecond, std::int64_t>, std::chrono::seconds>);  // truncating
+  static_assert(static_cast<std::chrono::seconds>(quantity<millisecond, std::int64_t>(2500)).count() == 2);
+  static_assert(duration<double>(quantity<millisecond, std::int64_t>(250)).count() == 0.25);
+  static_assert(!std::is_constructible_v<std::chrono::seconds, quantity<metre_per_second, std::int64_t>>);
+
+  constexpr std::chrono::nanoseconds to_chrono(const quantity<nanosecond, std::int64_t>& q) { return q; }
+  static_assert(to_chrono(quantity<microsecond, std::int64_t>(3)).count() == 3000);
+
+  // quantity_cast
+
+  static_assert(quantity_cast<quantity<second, std::int64_t>>(std::chrono::milliseconds(1999)).count() == 1);
+  static_assert(quantity_cast<quantity<minute, double>>(std::chrono::seconds(90)).count() == 1.5);
+  static_assert(quantity_cast<std::chrono::seconds>(quantity<millisecond, std::int64_t>(1999)).count() == 1);
+  static_assert(quantity_cast<std::chrono::milliseconds>(quantity<hour, int>(1)).count() == 3'600'000);
+  static_assert(std::is_same_v<decltype(quantity_cast<std::chrono::seconds>(quantity<second, std::int64_t>(1))),
+                               std::chrono::seconds>);
+
+  // arithmetic after conversion
+
+  static_assert(quantity<metre, std::int64_t>(10) / quantity(std::chrono::seconds(2)) == quantity<metre_per_second, std::int64_t>(5));
+
+}  // namespace
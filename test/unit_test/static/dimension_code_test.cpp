@@ -0,0 +1,119 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/dimension_code.h>
+#include <units/dimensions/acceleration.h>
+#include <units/dimensions/area.h>
+#include <units/dimensions/capacitance.h>
+#include <units/dimensions/energy.h>
+#include <units/dimensions/force.h>
+#include <units/dimensions/frequency.h>
+#include <units/dimensions/power.h>
+#include <units/dimensions/pressure.h>
+#include <units/dimensions/velocity.h>
+#include <units/dimensions/volume.h>
+
+namespace {
+
+  using namespace units;
+
+  struct base_dim_digital_information : base_dimension<"digital information", "b"> {};
+  struct digital_information : derived_dimension<digital_information, units::exp<base_dim_digital_information, 1>> {};
+
+  struct sqrt_length : derived_dimension<sqrt_length, units::exp<base_dim_length, 1, 2>> {};
+  struct cbrt_time : derived_dimension<cbrt_time, units::exp<base_dim_time, -1, 3>> {};
+  struct too_big : derived_dimension<too_big, units::exp<base_dim_mass, 22>> {};
+  struct fifth_root : derived_dimension<fifth_root, units::exp<base_dim_mass, 1, 5>> {};
+
+  // EncodableDimension
+
+  static_assert(EncodableDimension<length>);
+  static_assert(EncodableDimension<capacitance>);
+  static_assert(EncodableDimension<sqrt_length>);
+  static_assert(EncodableDimension<cbrt_time>);
+  static_assert(!EncodableDimension<digital_information>);
+  static_assert(!EncodableDimension<too_big>);
+  static_assert(!EncodableDimension<fifth_root>);
+
+  // dimension_code_of
+
+  static_assert(dimension_code_of<length>.scaled_exponent(0) == dimension_code::exponent_scale);
+  static_assert(dimension_code_of<units::time>.scaled_exponent(2) == dimension_code::exponent_scale);
+  static_assert(dimension_code_of<frequency>.scaled_exponent(2) == -dimension_code::exponent_scale);
+  static_assert(dimension_code_of<sqrt_length>.scaled_exponent(0) == 6);
+  static_assert(dimension_code_of<cbrt_time>.scaled_exponent(2) == -4);
+  static_assert(dimension_code_of<dimension<>>.is_dimensionless());
+  static_assert(!dimension_code_of<length>.is_dimensionless());
+
+  static_assert(dimension_code_of<length> != dimension_code_of<units::time>);
+  static_assert(dimension_code_of<energy> != dimension_code_of<power>);
+
+  // multiply and divide match compile-time dimension operations
+
+  static_assert(dimension_code_of<length> / dimension_code_of<units::time> == dimension_code_of<velocity>);
+  static_assert(dimension_code_of<velocity> / dimension_code_of<units::time> == dimension_code_of<acceleration>);
+  static_assert(dimension_code_of<mass> * dimension_code_of<acceleration> == dimension_code_of<force>);
+  static_assert(dimension_code_of<force> * dimension_code_of<length> == dimension_code_of<energy>);
+  static_assert(dimension_code_of<energy> / dimension_code_of<units::time> == dimension_code_of<power>);
+  static_assert(dimension_code_of<force> / dimension_code_of<area> == dimension_code_of<pressure>);
+  static_assert(dimension_code() / dimension_code_of<units::time> == dimension_code_of<frequency>);
+  static_assert(dimension_code_of<velocity> / dimension_code_of<velocity> == dimension_code());
+  static_assert(dimension_code_of<frequency> * dimension_code_of<units::time> == dimension_code());
+
+  static_assert(dimension_code_of<dimension_multiply<force, length>> == dimension_code_of<force> * dimension_code_of<length>);
+  static_assert(dimension_code_of<dimension_divide<power, energy>> == dimension_code_of<power> / dimension_code_of<energy>);
+  static_assert(dimension_code_of<dim_invert<capacitance>> == dimension_code() / dimension_code_of<capacitance>);
+
+  // pow
+
+  static_assert(pow(dimension_code_of<length>, 2) == dimension_code_of<area>);
+  static_assert(pow(dimension_code_of<length>, 3) == dimension_code_of<volume>);
+  static_assert(pow(dimension_code_of<volume>, 1, 3) == dimension_code_of<length>);
+  static_assert(pow(dimension_code_of<area>, 1, 2) == dimension_code_of<length>);
+  static_assert(pow(dimension_code_of<length>, 1, 2) == dimension_code_of<sqrt_length>);
+  static_assert(pow(dimension_code_of<units::time>, -1) == dimension_code_of<frequency>);
+  static_assert(pow(dimension_code_of<dimension_pow<energy, 2>>, 1, 2) == dimension_code_of<energy>);
+
+  // overflow of an exponent field
+
+  constexpr dimension_code metre_21 = dimension_code::from_exponent(0, 21);
+  constexpr dimension_code kilogram_21 = dimension_code::from_exponent(1, 21);
+
+  static_assert(!multiplication_overflows(pow(dimension_code_of<length>, 20), dimension_code_of<length>));
+  static_assert(multiplication_overflows(metre_21, dimension_code_of<length>));
+  static_assert(multiplication_overflows(pow(dimension_code_of<length>, -21), dimension_code_of<dim_invert<length>>));
+  static_assert(!multiplication_overflows(metre_21, kilogram_21));
+  static_assert(!multiplication_overflows(metre_21, dimension_code_of<dim_invert<length>>));
+  static_assert(multiplication_overflows(metre_21 * kilogram_21, dimension_code_of<mass>));
+
+  static_assert(!division_overflows(metre_21, dimension_code_of<length>));
+  static_assert(division_overflows(metre_21, dimension_code_of<dim_invert<length>>));
+  static_assert(division_overflows(pow(dimension_code_of<length>, -21), dimension_code_of<length>));
+  static_assert(!division_overflows(dimension_code(), metre_21));
+  static_assert(division_overflows(dimension_code(), dimension_code::from_exponent(0, -64, 3)));
+  static_assert(!division_overflows(dimension_code(), dimension_code::from_exponent(0, 63, 3)));
+
+  // bits round trip
+
+  static_assert(dimension_code::from_bits(dimension_code_of<capacitance>.bits()) == dimension_code_of<capacitance>);
+
+}  // namespace
@@ -21,6 +21,10 @@
 // SOFTWARE.
 
 #include "units/dimensions/area.h"
+#include "units/dimensions/energy.h"
+#include "units/dimensions/force.h"
+#include "units/dimensions/frequency.h"
+#include "units/dimensions/volume.h"
 #include "units/math.h"
 
 using namespace units;
@@ -31,5 +35,51 @@ namespace {
   static_assert(std::is_same_v<decltype(pow<1>(2m)), decltype(2m)>);
   static_assert(std::is_same_v<decltype(pow<2>(2m)), decltype(4sq_m)>);
   static_assert(std::is_same_v<decltype(sqrt(4sq_m)), decltype(2m)>);
+  static_assert(std::is_same_v<decltype(cbrt(8cub_km)), decltype(2km)>);
+  static_assert(std::is_same_v<decltype(pow<1, 3>(8cub_m)), decltype(2m)>);
+  static_assert(std::is_same_v<decltype(pow<2, 3>(8cub_m)), decltype(4sq_m)>);
+  static_assert(std::is_same_v<decltype(pow<2, 4>(4sq_m)), decltype(2m)>);
+  static_assert(std::is_same_v<decltype(pow<-1>(2.0s)), decltype(0.5Hz)>);
+
+  // integral powers are exact and constexpr
+  static_assert(pow<0>(2m) == 1);
+  static_assert(pow<2>(3m) == 9sq_m);
+  static_assert(pow<3>(3km) == 27cub_km);
+  static_assert(pow<3>(quantity<metre, std::int64_t>(2'000'001)).count() == 8'000'012'000'006'000'001);
+  static_assert(pow<2>(1.5m) == 2.25sq_m);
+  static_assert(pow<-2>(2.0m).count() == 0.25);
+
+  template<typename Q>
+  concept has_negative_pow = requires(Q q) { pow<-1>(q); };
+  static_assert(has_negative_pow<quantity<metre, double>>);
+  static_assert(!has_negative_pow<quantity<metre, std::int64_t>>);  // would truncate
+
+
+  // abs, min, max, clamp
+
+  static_assert(abs(-2m) == 2m);
+  static_assert(abs(2.5m) == 2.5m);
+  static_assert(std::is_same_v<decltype(abs(-2km)), decltype(2km)>);
+
+  static_assert(min(1km, 999m) == 999m);
+  static_assert(max(1km, 999m) == 1000m);
+  static_assert(std::is_same_v<decltype(min(1km, 999m)), decltype(1m)>);
+  static_assert(clamp(5m, 1m, 3m) == 3m);
+  static_assert(clamp(-5m, 1m, 3m) == 1m);
+  static_assert(clamp(2m, 1m, 3km) == 2m);
+  static_assert(std::is_same_v<decltype(clamp(2km, 1m, 3km)), decltype(2m)>);
+
+  // fma
+
+  static_assert(fma(2m, 3N, 4_J) == 10_J);
+  static_assert(std::is_same_v<decltype(fma(2m, 3N, 4_J)), decltype(10_J)>);
+  static_assert(fma(2km, 3N, 4_J) == 6004_J);     // product scaled to the common unit
+  static_assert(std::is_same_v<decltype(fma(2km, 3N, 4kJ)), decltype(1kJ)>);
+  static_assert(fma(2km, 3N, 4kJ) == 10kJ);
+  static_assert(fma(2m, 3m, 4sq_m) == 10sq_m);
+
+  template<typename A, typename B, typename C>
+  concept has_fma = requires(A a, B b, C c) { fma(a, b, c); };
+  static_assert(!has_fma<decltype(2m), decltype(3m), decltype(4_J)>);
 
 }  // namespace
@@ -0,0 +1,133 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/parse_unit.h>
+
+namespace {
+
+  using namespace units;
+
+  template<Unit U>
+  constexpr bool parses_as(std::string_view expr)
+  {
+    const auto u = parse_unit(expr);
+    return u && u->dimension == runtime_unit_of<U>.dimension &&
+           u->factor / runtime_unit_of<U>.factor > 1 - 1e-12 && u->factor / runtime_unit_of<U>.factor < 1 + 1e-12;
+  }
+
+  template<Dimension D>
+  constexpr bool has_dimension(std::string_view expr)
+  {
+    const auto u = parse_unit(expr);
+    return u && u->dimension == dimension_code_of<D>;
+  }
+
+  // single symbols
+
+  static_assert(parses_as<metre>("m"));
+  static_assert(parses_as<kilometre>("km"));
+  static_assert(parses_as<kilogram>("kg"));
+  static_assert(parses_as<microsecond>("µs"));
+  static_assert(parses_as<minute>("min"));
+  static_assert(parses_as<mile>("mi"));
+  static_assert(parses_as<kilojoule>("kJ"));
+
+  // SI prefixes applied to predefined units
+
+  static_assert(parse_unit("mg")->factor == 1e-6);
+  static_assert(parse_unit("hPa")->factor == 100);
+  static_assert(parse_unit("dam")->factor == 10);
+  static_assert(parse_unit("dm")->factor == 0.1);
+  static_assert(parse_unit("GW*h")->factor == 3.6e12);
+  static_assert(has_dimension<power>("kW"));
+
+  // compound expressions match compile-time dimension operations
+
+  static_assert(parses_as<newton>("kg*m/s^2"));
+  static_assert(parses_as<newton>("kg⋅m⋅s⁻²"));
+  static_assert(parses_as<newton>("kg·m/s²"));
+  static_assert(parses_as<joule>("N*m"));
+  static_assert(parses_as<joule>("kg * m^2 / s^2"));
+  static_assert(parses_as<watt>("J/s"));
+  static_assert(parses_as<pascal>("N/m^2"));
+  static_assert(parses_as<metre_per_second>("m/s"));
+  static_assert(parses_as<metre_per_second_sq>("m/s/s"));
+  static_assert(parses_as<kilometre_per_hour>("km/h"));
+  static_assert(parses_as<mile_per_hour>("mi/h"));
+  static_assert(parses_as<square_foot>("ft^2"));
+  static_assert(parses_as<cubic_centimetre>("cm³"));
+  static_assert(parses_as<hertz>("1/s"));
+  static_assert(parses_as<hertz>("s^-1"));
+  static_assert(parses_as<farad>("C/V"));
+
+  static_assert(has_dimension<dimension_multiply<force, length>>("N*m"));
+  static_assert(has_dimension<dimension_divide<energy, units::time>>("J/s"));
+  static_assert(has_dimension<dimension_divide<length, units::time>>("km/h"));
+  static_assert(has_dimension<dimension_divide<energy, dimension_multiply<mass, temperature>>>("J/(kg*K)"));
+  static_assert(has_dimension<dimension_divide<energy, substance>>("J / mol"));
+
+  // invalid expressions
+
+  static_assert(!parse_unit(""));
+  static_assert(!parse_unit("parsec"));
+  static_assert(!parse_unit("kg*"));
+  static_assert(!parse_unit("kg/"));
+  static_assert(!parse_unit("m^"));
+  static_assert(!parse_unit("(m/s"));
+  static_assert(!parse_unit("m/s)"));
+  static_assert(!parse_unit("m s"));
+
+  // exponents that do not fit in a dimension_code
+
+  static_assert(has_dimension<dimension_pow<length, 21>>("m^21"));
+  static_assert(has_dimension<dimension_pow<length, -21>>("m^-21"));
+  static_assert(has_dimension<dimension_pow<length, 21>>("m²¹"));
+  static_assert(!parse_unit("m^22"));
+  static_assert(!parse_unit("m^-22"));
+  static_assert(!parse_unit("m²²"));
+  static_assert(!parse_unit("m⁻²²"));
+  static_assert(!parse_unit("m^99999999999999999999999999"));
+  static_assert(!parse_unit("m^000000000000000000000000022"));
+  static_assert(!parse_unit("(m^11)^2"));
+  static_assert(parses_as<metre>("((((((((((((((((((((((((((((((((m))))))))))))))))))))))))))))))))"));
+  static_assert(!parse_unit("(((((((((((((((((((((((((((((((((m)))))))))))))))))))))))))))))))))"));
+  static_assert(!parse_unit("m^20*m^2"));
+  static_assert(!parse_unit("m^-20/m^2"));
+  static_assert(!parse_unit("1/(m^-11)^2"));
+  static_assert(has_dimension<length>("m^21/m^20"));
+
+  // prefixes are not combined
+
+  static_assert(!parse_unit("mkg"));
+  static_assert(!parse_unit("kkg"));
+  static_assert(!parse_unit("Mkm"));
+  static_assert(parses_as<gram>("g"));
+  static_assert(parse_unit("Mg")->factor == 1e3);
+  static_assert(parses_as<minute>("min"));
+
+  // conversions
+
+  static_assert(parse_conversion("km/h", "m/s")->factor * 36 > 10 - 1e-12);
+  static_assert(parse_conversion("km/h", "m/s")->factor * 36 < 10 + 1e-12);
+  static_assert(!parse_conversion("km/h", "m"));
+
+}  // namespace
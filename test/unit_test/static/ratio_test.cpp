@@ -56,6 +56,19 @@ namespace {
   static_assert(std::is_same_v<ratio_sqrt<ratio<0>>, ratio<0>>);
   static_assert(std::is_same_v<ratio_sqrt<ratio<1, 4>>, ratio<1, 2>>);
 
+  template<typename R, std::intmax_t N>
+  concept has_ratio_root = requires { typename ratio_root<R, N>; };
+
+  static_assert(std::is_same_v<ratio_root<ratio<8>, 3>, ratio<2>>);
+  static_assert(std::is_same_v<ratio_root<ratio<1, 1000000000>, 3>, ratio<1, 1000>>);
+  static_assert(std::is_same_v<ratio_root<ratio<-27, 8>, 3>, ratio<-3, 2>>);
+  static_assert(std::is_same_v<ratio_root<ratio<0>, 2>, ratio<0>>);
+  static_assert(std::is_same_v<ratio_root<ratio<5>, 1>, ratio<5>>);
+  static_assert(std::is_same_v<ratio_root<ratio<1'000'000'000'000'000'000>, 2>, ratio<1'000'000'000>>);
+  static_assert(!has_ratio_root<ratio<2>, 2>);
+  static_assert(!has_ratio_root<ratio<-4>, 2>);
+  static_assert(!has_ratio_root<ratio<1, 10>, 3>);
+
   // common_ratio
 
   static_assert(std::is_same_v<common_ratio<ratio<1>, ratio<1000>>, ratio<1>>);
@@ -0,0 +1,80 @@
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Mateusz Pusz
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#include <units/symbol_table.h>
+#include <units/dimensions/energy.h>
+#include <units/dimensions/frequency.h>
+#include <units/dimensions/length.h>
+#include <units/dimensions/mass.h>
+#include <units/dimensions/power.h>
+#include <units/dimensions/si_units.h>
+#include <units/dimensions/time.h>
+#include <units/dimensions/velocity.h>
+
+namespace {
+
+  using namespace units;
+
+  using table = symbol_table<unit_list<metre, millimetre, centimetre, kilometre, yard, foot, inch, mile,
+                                       gram, kilogram,
+                                       second, nanosecond, microsecond, millisecond, minute, hour,
+                                       joule, millijoule, kilojoule, megajoule, gigajoule,
+                                       watt, milliwatt, kilowatt, megawatt, gigawatt,
+                                       hertz, millihertz, kilohertz, megahertz, gigahertz, terahertz,
+                                       metre_per_second>>;
+
+  static_assert(table::size() == 33);
+
+  // lookup
+
+  static_assert(table::find("kJ") != nullptr);
+  static_assert(table::find("kJ")->symbol == "kJ");
+  static_assert(table::find("kJ")->num == 1000);
+  static_assert(table::find("kJ")->den == 1);
+  static_assert(table::find("kJ")->dimension == dimension_code_of<energy>);
+
+  static_assert(table::find("µs")->num == 1);
+  static_assert(table::find("µs")->den == 1'000'000);
+  static_assert(table::find("µs")->dimension == dimension_code_of<units::time>);
+
+  static_assert(table::find("mi")->num == mile::ratio::num);
+  static_assert(table::find("mi")->den == mile::ratio::den);
+  static_assert(table::find("mi")->dimension == dimension_code_of<length>);
+
+  static_assert(table::find("g")->num == 1);
+  static_assert(table::find("g")->den == 1000);
+  static_assert(table::find("m/s")->dimension == dimension_code_of<velocity>);
+
+  // missing symbols
+
+  static_assert(table::find("") == nullptr);
+  static_assert(table::find("kj") == nullptr);
+  static_assert(table::find("kJs") == nullptr);
+  static_assert(!table::contains("parsec"));
+  static_assert(table::contains("h"));
+
+  // all predefined units
+
+  static_assert(symbol_table<si_units>::find("m³")->dimension == dimension_code_of<volume>);
+  static_assert(symbol_table<si_units>::find("mol")->dimension == dimension_code_of<substance>);
+
+}  // namespace
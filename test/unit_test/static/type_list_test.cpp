@@ -90,6 +90,7 @@ namespace {
                                type_list<exp<d0, 1>, exp<d1, 1>>>);
   static_assert(std::is_same_v<type_list_merge_sorted<type_list<exp<d1, 1>>, type_list<exp<d0, 1>>, exp_less>,
                                type_list<exp<d0, 1>, exp<d1, 1>>>);
+  static_assert(std::is_same_v<type_list_merge_sorted<type_list<>, type_list<>, exp_less>, type_list<>>);
 
   // type_list_sort
 
@@ -21,9 +21,11 @@
 // SOFTWARE.
 
 #include <units/dimensions/acceleration.h>
+#include <units/dimensions/angle.h>
 #include <units/dimensions/area.h>
 #include <units/dimensions/capacitance.h>
 #include <units/dimensions/current.h>
+#include <units/dimensions/dimensionless.h>
 #include <units/dimensions/electric_charge.h>
 #include <units/dimensions/energy.h>
 #include <units/dimensions/force.h>
@@ -92,6 +94,23 @@ namespace {
 
   // luminous intensity
 
+  // angle
+
+  static_assert(1rad == 1000mrad);
+  static_assert(180deg == quantity<degree>(180));
+  static_assert(quantity_cast<quantity<radian, double>>(180.deg).count() > 3.14159265358979);
+  static_assert(quantity_cast<quantity<radian, double>>(180.deg).count() < 3.1415926535898);
+  static_assert(Angle<decltype(1deg)>);
+  static_assert(!Dimensionless<decltype(1rad)>);
+
+  // dimensionless
+
+  static_assert(quantity<one>(1) == quantity<percent>(100));
+  static_assert(quantity<percent>(1) == quantity<parts_per_million>(10'000));
+  static_assert(quantity<per_mille>(5) == quantity<percent>(0.5));
+  static_assert(Dimensionless<quantity<percent>>);
+  static_assert(10m / 5m == 2);  // a quotient of two quantities of the same dimension stays a scalar
+
 
   /* ************** DERIVED DIMENSIONS WITH NAMED UNITS **************** */
 